@@ -0,0 +1,75 @@
+#ifndef TEAPOT_HOST_FURI_H
+#define TEAPOT_HOST_FURI_H
+
+/*
+ * Host stand-ins for the furi thread primitives used by teapot_renderer.c
+ * and by the app's main loop as host/teapot_bench.c replays it, implemented
+ * with pthreads in furi_host.c. Only the calls those make are provided,
+ * with the same signatures and semantics as furi.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FuriWaitForever 0xFFFFFFFFU
+
+#define FuriFlagWaitAny 0x00000000U
+#define FuriFlagError 0x80000000U
+#define FuriFlagErrorTimeout 0xFFFFFFFEU
+
+typedef enum {
+    FuriStatusOk = 0,
+    FuriStatusErrorTimeout = -2,
+    FuriStatusErrorResource = -3,
+} FuriStatus;
+
+typedef enum {
+    FuriThreadPriorityNone = 0,
+    FuriThreadPriorityIdle = 1,
+    FuriThreadPriorityLowest = 14,
+    FuriThreadPriorityLow = 15,
+    FuriThreadPriorityNormal = 16,
+    FuriThreadPriorityHigh = 17,
+    FuriThreadPriorityHighest = 18,
+} FuriThreadPriority;
+
+typedef struct FuriThread FuriThread;
+typedef void* FuriThreadId;
+typedef int32_t (*FuriThreadCallback)(void* context);
+
+FuriThread* furi_thread_alloc_ex(
+    const char* name,
+    uint32_t stack_size,
+    FuriThreadCallback callback,
+    void* context);
+void furi_thread_free(FuriThread* thread);
+// Priorities are recorded but not applied, Linux threads keep the default
+void furi_thread_set_priority(FuriThread* thread, FuriThreadPriority priority);
+void furi_thread_start(FuriThread* thread);
+bool furi_thread_join(FuriThread* thread);
+FuriThreadId furi_thread_get_id(FuriThread* thread);
+
+// Kernel ticks are milliseconds, as on the Flipper
+uint32_t furi_ms_to_ticks(uint32_t milliseconds);
+uint32_t furi_get_tick(void);
+void furi_delay_ms(uint32_t milliseconds);
+
+// Set flags on a thread, returns the flags after setting
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags);
+// Wait on the calling thread's flags for up to timeout ticks, returns and
+// clears the matched ones or FuriFlagErrorTimeout
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout);
+// The calling thread's flags, without clearing them
+uint32_t furi_thread_flags_get(void);
+
+typedef struct FuriMessageQueue FuriMessageQueue;
+
+FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size);
+void furi_message_queue_free(FuriMessageQueue* queue);
+// Copy a message in, waiting up to timeout ticks for room
+FuriStatus furi_message_queue_put(FuriMessageQueue* queue, const void* msg_ptr, uint32_t timeout);
+// Copy the oldest message out, waiting up to timeout ticks for one. A
+// timeout of 0 polls and returns FuriStatusErrorResource when empty.
+FuriStatus furi_message_queue_get(FuriMessageQueue* queue, void* msg_ptr, uint32_t timeout);
+
+#endif // TEAPOT_HOST_FURI_H
@@ -0,0 +1,208 @@
+#include "furi.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct FuriThread {
+    pthread_t handle;
+    const char* name;
+    uint32_t stack_size;
+    FuriThreadPriority priority;
+    FuriThreadCallback callback;
+    void* context;
+    
+    pthread_mutex_t flags_mutex;
+    pthread_cond_t flags_changed;
+    uint32_t flags;
+};
+
+struct FuriMessageQueue {
+    pthread_mutex_t mutex;
+    pthread_cond_t changed; // A message was added or removed
+    uint8_t* messages; // Ring of capacity messages of size bytes
+    uint32_t capacity;
+    uint32_t size;
+    uint32_t first;
+    uint32_t count;
+};
+
+// The FuriThread of the calling thread, for furi_thread_flags_wait()
+static __thread FuriThread* current_thread = NULL;
+
+static void* furi_thread_body(void* arg) {
+    FuriThread* thread = arg;
+    current_thread = thread;
+    thread->callback(thread->context);
+    return NULL;
+}
+
+FuriThread* furi_thread_alloc_ex(
+    const char* name,
+    uint32_t stack_size,
+    FuriThreadCallback callback,
+    void* context) {
+    FuriThread* thread = calloc(1, sizeof(FuriThread));
+    thread->name = name;
+    thread->stack_size = stack_size;
+    thread->priority = FuriThreadPriorityNormal;
+    thread->callback = callback;
+    thread->context = context;
+    pthread_mutex_init(&thread->flags_mutex, NULL);
+    pthread_cond_init(&thread->flags_changed, NULL);
+    return thread;
+}
+
+void furi_thread_free(FuriThread* thread) {
+    pthread_cond_destroy(&thread->flags_changed);
+    pthread_mutex_destroy(&thread->flags_mutex);
+    free(thread);
+}
+
+void furi_thread_set_priority(FuriThread* thread, FuriThreadPriority priority) {
+    thread->priority = priority;
+}
+
+void furi_thread_start(FuriThread* thread) {
+    // The host stack stays at the pthread default, stack_size is a device
+    // budget and far too small for glibc
+    pthread_create(&thread->handle, NULL, furi_thread_body, thread);
+}
+
+bool furi_thread_join(FuriThread* thread) {
+    return pthread_join(thread->handle, NULL) == 0;
+}
+
+FuriThreadId furi_thread_get_id(FuriThread* thread) {
+    return thread;
+}
+
+uint32_t furi_ms_to_ticks(uint32_t milliseconds) {
+    return milliseconds;
+}
+
+uint32_t furi_get_tick(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+void furi_delay_ms(uint32_t milliseconds) {
+    struct timespec ts = {.tv_sec = milliseconds / 1000, .tv_nsec = (long)(milliseconds % 1000) * 1000000};
+    while(nanosleep(&ts, &ts) == -1 && errno == EINTR) {
+    }
+}
+
+// Absolute CLOCK_REALTIME time timeout ticks from now, for the timed waits
+static struct timespec deadline_after(uint32_t timeout) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout / 1000;
+    deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+    if(deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    return deadline;
+}
+
+// Wait on cond until woken, false once timeout ticks to deadline passed
+static bool cond_wait_until(pthread_cond_t* cond, pthread_mutex_t* mutex, uint32_t timeout, const struct timespec* deadline) {
+    if(timeout == FuriWaitForever) {
+        pthread_cond_wait(cond, mutex);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, mutex, deadline) != ETIMEDOUT;
+}
+
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags) {
+    FuriThread* thread = thread_id;
+    pthread_mutex_lock(&thread->flags_mutex);
+    thread->flags |= flags;
+    uint32_t result = thread->flags;
+    pthread_cond_broadcast(&thread->flags_changed);
+    pthread_mutex_unlock(&thread->flags_mutex);
+    return result;
+}
+
+uint32_t furi_thread_flags_get(void) {
+    FuriThread* thread = current_thread;
+    pthread_mutex_lock(&thread->flags_mutex);
+    uint32_t result = thread->flags;
+    pthread_mutex_unlock(&thread->flags_mutex);
+    return result;
+}
+
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    (void)options; // Only FuriFlagWaitAny is used
+    FuriThread* thread = current_thread;
+    
+    struct timespec deadline = deadline_after(timeout);
+    
+    pthread_mutex_lock(&thread->flags_mutex);
+    while(!(thread->flags & flags)) {
+        if(!cond_wait_until(&thread->flags_changed, &thread->flags_mutex, timeout, &deadline)) {
+            pthread_mutex_unlock(&thread->flags_mutex);
+            return FuriFlagErrorTimeout;
+        }
+    }
+    uint32_t result = thread->flags & flags;
+    thread->flags &= ~result;
+    pthread_mutex_unlock(&thread->flags_mutex);
+    return result;
+}
+
+FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
+    FuriMessageQueue* queue = calloc(1, sizeof(FuriMessageQueue));
+    queue->messages = malloc((size_t)msg_count * msg_size);
+    queue->capacity = msg_count;
+    queue->size = msg_size;
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    return queue;
+}
+
+void furi_message_queue_free(FuriMessageQueue* queue) {
+    pthread_cond_destroy(&queue->changed);
+    pthread_mutex_destroy(&queue->mutex);
+    free(queue->messages);
+    free(queue);
+}
+
+FuriStatus furi_message_queue_put(FuriMessageQueue* queue, const void* msg_ptr, uint32_t timeout) {
+    struct timespec deadline = deadline_after(timeout);
+    
+    pthread_mutex_lock(&queue->mutex);
+    while(queue->count == queue->capacity) {
+        if(!timeout || !cond_wait_until(&queue->changed, &queue->mutex, timeout, &deadline)) {
+            pthread_mutex_unlock(&queue->mutex);
+            return timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+        }
+    }
+    uint32_t slot = (queue->first + queue->count) % queue->capacity;
+    memcpy(queue->messages + (size_t)slot * queue->size, msg_ptr, queue->size);
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->mutex);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_message_queue_get(FuriMessageQueue* queue, void* msg_ptr, uint32_t timeout) {
+    struct timespec deadline = deadline_after(timeout);
+    
+    pthread_mutex_lock(&queue->mutex);
+    while(!queue->count) {
+        if(!timeout || !cond_wait_until(&queue->changed, &queue->mutex, timeout, &deadline)) {
+            pthread_mutex_unlock(&queue->mutex);
+            return timeout ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+        }
+    }
+    memcpy(msg_ptr, queue->messages + (size_t)queue->first * queue->size, queue->size);
+    queue->first = (queue->first + 1) % queue->capacity;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->mutex);
+    return FuriStatusOk;
+}
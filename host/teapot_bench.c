@@ -0,0 +1,553 @@
+#include "teapot_bench.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "furi.h"
+#include "teapot_lod.h"
+
+#define AUTO_ROTATE_SPEED 0.05f // Same step as the app's auto-rotation
+#define LINE_SEED 0x2545F491u // Same line set on every run
+#define LINE_ROUNDS 9 // Timed passes over a line set, the fastest counts
+#define FRAME_DELAY 33 // The app's frame period in ms
+#define EVENT_QUEUE_SIZE 8 // The app's input queue length
+#define INPUT_SEED 0x6A09E667u // Same input timing on every run
+#define INPUT_GAP_MIN 20 // ms between presses
+#define INPUT_GAP_MAX 120
+#define INPUT_BURST 3 // Presses queued at once, as repeats of a held key
+#define INPUT_BURST_PERCENT 20 // Share of presses that come as a burst
+#define INPUT_ROTATION 0.25f // The app's rotation per arrow press
+#define STATS_WINDOW 1000 // ms between the app's FPS and CPU load updates
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// CPU time of the calling thread, the replayed main loop
+static uint64_t thread_cpu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void rotate_camera(TeapotCamera* camera, int axis, float angle) {
+    if(axis == 0) camera->rotation.x += angle;
+    if(axis == 1) camera->rotation.y += angle;
+    if(axis == 2) camera->rotation.z += angle;
+}
+
+// A rotation around X, Y or Z as a full 4x4 matrix
+static void rotation_matrix(Matrix4x4* m, int axis, float angle) {
+    float s = sinf(angle), c = cosf(angle);
+    for(int i = 0; i < 4; i++) {
+        for(int j = 0; j < 4; j++) {
+            m->m[i][j] = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+    int a = axis == 0 ? 1 : 0;
+    int b = axis == 2 ? 1 : 2;
+    m->m[a][a] = c;
+    m->m[b][b] = c;
+    // Y turns the other way round, as in rotate_y_matrix()
+    m->m[a][b] = axis == 1 ? s : -s;
+    m->m[b][a] = axis == 1 ? -s : s;
+}
+
+// Reference: the renderer's transform before the combined model matrix,
+// one 4x4 matrix and a w divide per rotation
+static void multiply_matrix_vector(const Matrix4x4* m, const Vec3f* in, Vec3f* out) {
+    out->x = in->x * m->m[0][0] + in->y * m->m[1][0] + in->z * m->m[2][0] + m->m[3][0];
+    out->y = in->x * m->m[0][1] + in->y * m->m[1][1] + in->z * m->m[2][1] + m->m[3][1];
+    out->z = in->x * m->m[0][2] + in->y * m->m[1][2] + in->z * m->m[2][2] + m->m[3][2];
+    float w = in->x * m->m[0][3] + in->y * m->m[1][3] + in->z * m->m[2][3] + m->m[3][3];
+
+    if(w != 0.0f) {
+        out->x /= w;
+        out->y /= w;
+        out->z /= w;
+    }
+}
+
+// A transformed vertex
+typedef struct {
+    Vec3f view;
+    int16_t x, y; // Screen position, when in_front
+    bool in_front;
+} BenchVertex;
+
+// Transform and project like the renderer did, three 4x4 products per vertex
+static void reference_transform(
+    const RenderBuffer* rb,
+    const TeapotCamera* camera,
+    const Vec3f* vertices,
+    int count,
+    BenchVertex* out) {
+    Matrix4x4 rot_x_matrix, rot_y_matrix, rot_z_matrix;
+    rotation_matrix(&rot_x_matrix, 0, camera->rotation.x);
+    rotation_matrix(&rot_y_matrix, 1, camera->rotation.y);
+    rotation_matrix(&rot_z_matrix, 2, camera->rotation.z);
+
+    for(int i = 0; i < count; i++) {
+        Vec3f temp1, temp2;
+        multiply_matrix_vector(&rot_x_matrix, &vertices[i], &temp1);
+        multiply_matrix_vector(&rot_y_matrix, &temp1, &temp2);
+        multiply_matrix_vector(&rot_z_matrix, &temp2, &temp1);
+
+        Vec3f* v = &out[i].view;
+        v->x = temp1.x * camera->scale + camera->position.x;
+        v->y = temp1.y * camera->scale + camera->position.y;
+        v->z = temp1.z * camera->scale + camera->position.z;
+        out[i].in_front = v->z >= 1.0f;
+        if(out[i].in_front) {
+            out[i].x = (int16_t)((int)((v->x * PROJECTION_DISTANCE) / v->z) + rb->width / 2);
+            out[i].y = (int16_t)((int)((-v->y * PROJECTION_DISTANCE) / v->z) + rb->height / 2);
+        }
+    }
+}
+
+void bench_transform(RenderBuffer* rb, TeapotCamera camera, uint8_t lod, int axis, int rounds) {
+    const TeapotMesh* mesh = teapot_lods[lod];
+    int count = mesh->vertex_count;
+    // The reference reads float vertices, as meshes stored them then
+    Vec3f* vertices = malloc(sizeof(Vec3f) * count);
+    BenchVertex* reference = malloc(sizeof(BenchVertex) * count);
+    if(!vertices || !reference) {
+        fprintf(stderr, "Error: Out of memory\n");
+        free(vertices);
+        free(reference);
+        return;
+    }
+    for(int i = 0; i < count; i++) {
+        vertices[i].x = mesh->vertices[i * 3 + 0] * mesh->vertex_scale;
+        vertices[i].y = mesh->vertices[i * 3 + 1] * mesh->vertex_scale;
+        vertices[i].z = mesh->vertices[i * 3 + 2] * mesh->vertex_scale;
+    }
+
+    // Alternate the two per round, so both see the same cache and clock
+    uint64_t reference_ns = 0, engine_ns = 0;
+    float max_error = 0;
+    int max_pixels = 0;
+    bool ok = true;
+    for(int round = 0; round < rounds && ok; round++) {
+        uint64_t start = now_ns();
+        reference_transform(rb, &camera, vertices, count, reference);
+        uint64_t middle = now_ns();
+        ok = render_transform_all(rb, &camera, lod);
+        engine_ns += now_ns() - middle;
+        reference_ns += middle - start;
+
+        for(int i = 0; i < count && ok; i++) {
+            Vec3f view;
+            int16_t x, y;
+            bool in_front = render_transformed_vertex(i, &view, &x, &y);
+            max_error = fmaxf(max_error, fabsf(reference[i].view.x - view.x));
+            max_error = fmaxf(max_error, fabsf(reference[i].view.y - view.y));
+            max_error = fmaxf(max_error, fabsf(reference[i].view.z - view.z));
+            if(in_front && reference[i].in_front) {
+                int dx = abs(reference[i].x - x), dy = abs(reference[i].y - y);
+                if(dx > max_pixels) max_pixels = dx;
+                if(dy > max_pixels) max_pixels = dy;
+            }
+        }
+        rotate_camera(&camera, axis, AUTO_ROTATE_SPEED);
+    }
+
+    if(ok) {
+        double vertices_done = (double)count * rounds;
+        printf(
+            "transform %s, %d vertices x %d rounds: chained 4x4 %.2f ns/vertex, engine %.2f ns/vertex, "
+            "%.1fx faster, max difference %.2g, %d pixels\n",
+            mesh->name,
+            count,
+            rounds,
+            reference_ns / vertices_done,
+            engine_ns / vertices_done,
+            (double)reference_ns / (engine_ns ? engine_ns : 1),
+            max_error,
+            max_pixels);
+    } else {
+        fprintf(stderr, "Error: The engine caches are not allocated\n");
+    }
+
+    free(vertices);
+    free(reference);
+}
+
+// Classes of buffer_draw_line(), by which of its loops draws the line
+typedef enum {
+    LineShallow, // dx > 4 * dy, written as byte runs
+    LineDiagonal, // dy <= dx <= 4 * dy, one pixel per column
+    LineSteep, // dx < dy, one pixel per row
+    LineClassCount
+} LineClass;
+
+static const char* line_class_names[LineClassCount] = {"shallow", "diagonal", "steep"};
+
+static uint32_t xorshift32(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Reference: the line drawer before it wrote into the packed buffer, the
+// same Cohen-Sutherland clip, then one bounds-checked pixel per step
+static void buffer_draw_pixel(RenderBuffer* rb, int x, int y) {
+    if(x >= 0 && y >= 0 && x < rb->width && y < rb->height) {
+        uint16_t byte_idx = y * (rb->width / 8) + (x / 8);
+        uint8_t bit_pos = x % 8;
+        rb->buffer[byte_idx] |= (1 << bit_pos);
+    }
+}
+
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+static uint8_t clip_outcode(const RenderBuffer* rb, int x, int y) {
+    uint8_t code = 0;
+    if(x < 0) code |= CLIP_LEFT;
+    else if(x >= rb->width) code |= CLIP_RIGHT;
+    if(y < 0) code |= CLIP_TOP;
+    else if(y >= rb->height) code |= CLIP_BOTTOM;
+    return code;
+}
+
+static bool clip_line(const RenderBuffer* rb, int* x0, int* y0, int* x1, int* y1) {
+    int x_max = rb->width - 1;
+    int y_max = rb->height - 1;
+    uint8_t code0 = clip_outcode(rb, *x0, *y0);
+    uint8_t code1 = clip_outcode(rb, *x1, *y1);
+
+    while(true) {
+        if(!(code0 | code1)) return true;
+        if(code0 & code1) return false;
+
+        uint8_t code = code0 ? code0 : code1;
+        int x, y;
+        if(code & CLIP_BOTTOM) {
+            x = *x0 + (*x1 - *x0) * (y_max - *y0) / (*y1 - *y0);
+            y = y_max;
+        } else if(code & CLIP_TOP) {
+            x = *x0 + (*x1 - *x0) * (0 - *y0) / (*y1 - *y0);
+            y = 0;
+        } else if(code & CLIP_RIGHT) {
+            y = *y0 + (*y1 - *y0) * (x_max - *x0) / (*x1 - *x0);
+            x = x_max;
+        } else {
+            y = *y0 + (*y1 - *y0) * (0 - *x0) / (*x1 - *x0);
+            x = 0;
+        }
+
+        if(code == code0) {
+            *x0 = x;
+            *y0 = y;
+            code0 = clip_outcode(rb, x, y);
+        } else {
+            *x1 = x;
+            *y1 = y;
+            code1 = clip_outcode(rb, x, y);
+        }
+    }
+}
+
+static void reference_draw_line(RenderBuffer* rb, int16_t line_x0, int16_t line_y0, int16_t line_x1, int16_t line_y1) {
+    int x0 = line_x0, y0 = line_y0, x1 = line_x1, y1 = line_y1;
+    if(!clip_line(rb, &x0, &y0, &x1, &y1)) return;
+
+    int dx = abs(x1 - x0);
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0);
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int e2;
+
+    while(true) {
+        buffer_draw_pixel(rb, x0, y0);
+        if(x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if(e2 >= dy) {
+            if(x0 == x1) break;
+            err += dy;
+            x0 += sx;
+        }
+        if(e2 <= dx) {
+            if(y0 == y1) break;
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static LineClass line_class(const int16_t* line) {
+    int dx = abs(line[2] - line[0]);
+    int dy = abs(line[3] - line[1]);
+    if(dx > 4 * dy) return LineShallow;
+    return dx >= dy ? LineDiagonal : LineSteep;
+}
+
+// One pass over count lines into a cleared buffer, in ns
+static uint64_t time_lines(
+    RenderBuffer* rb,
+    void (*draw)(RenderBuffer*, int16_t, int16_t, int16_t, int16_t),
+    const int16_t* lines,
+    int count) {
+    render_buffer_clear(rb);
+    uint64_t start = now_ns();
+    for(int i = 0; i < count; i++) {
+        const int16_t* line = &lines[i * 4];
+        draw(rb, line[0], line[1], line[2], line[3]);
+    }
+    return now_ns() - start;
+}
+
+bool bench_lines(uint16_t width, uint16_t height, int count) {
+    int16_t* lines[LineClassCount];
+    RenderBuffer reference, packed;
+    bool ok = render_buffer_init(&reference, width, height) && render_buffer_init(&packed, width, height);
+    for(int c = 0; c < LineClassCount; c++) {
+        lines[c] = malloc(sizeof(int16_t) * 4 * count);
+        ok = ok && lines[c];
+    }
+
+    if(ok) {
+        // Ends anywhere within a quarter of the buffer around it, drawn
+        // until every class has count lines
+        uint32_t seed = LINE_SEED;
+        int filled[LineClassCount] = {0};
+        int span_x = width + width / 2, span_y = height + height / 2;
+        while(filled[LineShallow] < count || filled[LineDiagonal] < count || filled[LineSteep] < count) {
+            int16_t line[4];
+            for(int i = 0; i < 4; i++) {
+                int span = i % 2 ? span_y : span_x;
+                int size = i % 2 ? height : width;
+                line[i] = (int16_t)((int)(xorshift32(&seed) % span) - size / 4);
+            }
+            LineClass c = line_class(line);
+            if(filled[c] < count) memcpy(&lines[c][filled[c]++ * 4], line, sizeof(line));
+        }
+
+        printf("lines %ux%u, %d per class, ns/line per-pixel -> packed:", width, height, count);
+        double reference_total = 0, packed_total = 0;
+        for(int c = 0; c < LineClassCount && ok; c++) {
+            // Alternate the two per round, so both see the same cache and
+            // clock, and keep the fastest round of each
+            uint64_t reference_best = UINT64_MAX, packed_best = UINT64_MAX;
+            for(int round = 0; round < LINE_ROUNDS; round++) {
+                uint64_t elapsed = time_lines(&reference, reference_draw_line, lines[c], count);
+                if(elapsed < reference_best) reference_best = elapsed;
+                elapsed = time_lines(&packed, buffer_draw_line, lines[c], count);
+                if(elapsed < packed_best) packed_best = elapsed;
+            }
+            double reference_ns = (double)reference_best / count;
+            double packed_ns = (double)packed_best / count;
+            reference_total += reference_ns;
+            packed_total += packed_ns;
+            printf(" %s %.1f -> %.1f", line_class_names[c], reference_ns, packed_ns);
+            ok = !memcmp(reference.buffer, packed.buffer, (size_t)width / 8 * height);
+            if(!ok) printf("\nError: buffer_draw_line() and the reference differ on %s lines", line_class_names[c]);
+        }
+        if(ok) {
+            printf(
+                ", all %.1f -> %.1f (%.2fx)",
+                reference_total / LineClassCount,
+                packed_total / LineClassCount,
+                reference_total / packed_total);
+        }
+        printf("\n");
+    } else {
+        fprintf(stderr, "Error: Out of memory\n");
+    }
+
+    for(int c = 0; c < LineClassCount; c++) {
+        free(lines[c]);
+    }
+    render_buffer_free(&reference);
+    render_buffer_free(&packed);
+    return ok;
+}
+
+// An input event as the app queues it
+typedef struct {
+    uint32_t ticks; // profiler_ticks() in the input callback
+    bool stop; // Back, ends the loop
+} BenchEvent;
+
+typedef struct {
+    FuriMessageQueue* queue;
+    int events;
+    uint32_t stop_after; // ms after the last press until Back
+} InputFeed;
+
+// Stands in for the input callback
+static int32_t input_feed(void* context) {
+    InputFeed* feed = context;
+    uint32_t seed = INPUT_SEED;
+    for(int sent = 0; sent < feed->events;) {
+        furi_delay_ms(INPUT_GAP_MIN + xorshift32(&seed) % (INPUT_GAP_MAX - INPUT_GAP_MIN + 1));
+        int burst = xorshift32(&seed) % 100 < INPUT_BURST_PERCENT ? INPUT_BURST : 1;
+        for(int i = 0; i < burst && sent < feed->events; i++, sent++) {
+            BenchEvent event = {.ticks = profiler_ticks(), .stop = false};
+            furi_message_queue_put(feed->queue, &event, FuriWaitForever);
+        }
+    }
+    furi_delay_ms(feed->stop_after);
+    BenchEvent stop = {.ticks = profiler_ticks(), .stop = true};
+    furi_message_queue_put(feed->queue, &stop, FuriWaitForever);
+    return 0;
+}
+
+// A replayed main loop and its measurements
+typedef struct {
+    RenderBuffer* rb;
+    TeapotCamera camera;
+    RenderMode mode;
+    uint8_t lod;
+    RenderKey key;
+    bool input_pending; // Input applied but not yet presented
+    uint32_t input_ticks; // Queue time of the oldest such input
+    ProfileStageStats latency;
+    uint32_t renders;
+    uint32_t wakeups; // Returns from the queue or the frame delay
+} LoopReplay;
+
+// Apply an event as an arrow press, returns false for the stop event
+static bool replay_input(LoopReplay* replay, const BenchEvent* event) {
+    if(event->stop) return false;
+    replay->camera.rotation.y += INPUT_ROTATION;
+    if(!replay->input_pending) {
+        replay->input_pending = true;
+        replay->input_ticks = event->ticks;
+    }
+    return true;
+}
+
+// Render when the camera changed. There is no GUI to present to, so a
+// finished frame ends the latency of the oldest input it includes.
+static void replay_frame(LoopReplay* replay) {
+    if(!render_key_changed(&replay->key, &replay->camera, replay->mode, replay->lod)) return;
+    RenderStats stats;
+    render_complete_model(replay->rb, &replay->camera, replay->mode, replay->lod, &stats);
+    render_key_set(&replay->key, &replay->camera, replay->mode, replay->lod);
+    replay->renders++;
+    if(replay->input_pending) {
+        profile_stats_add(&replay->latency, profiler_ticks() - replay->input_ticks);
+        replay->input_pending = false;
+    }
+}
+
+// The loop before it blocked on the queue: poll, handle at most one event,
+// render, then always sleep a frame
+static void replay_poll_loop(LoopReplay* replay, FuriMessageQueue* queue) {
+    bool running = true;
+    while(running) {
+        BenchEvent event;
+        if(furi_message_queue_get(queue, &event, 0) == FuriStatusOk) {
+            running = replay_input(replay, &event);
+        }
+        replay_frame(replay);
+        furi_delay_ms(FRAME_DELAY);
+        replay->wakeups++;
+    }
+}
+
+// The app's loop: sleep on the queue until input or the next stats window,
+// drain everything queued, render once. Without auto-rotation nothing else
+// wakes it.
+static void replay_blocking_loop(LoopReplay* replay, FuriMessageQueue* queue) {
+    bool running = true;
+    uint32_t window_start = furi_get_tick();
+    while(running) {
+        int32_t remaining = (int32_t)(window_start + STATS_WINDOW - furi_get_tick());
+        BenchEvent event;
+        FuriStatus status = furi_message_queue_get(queue, &event, remaining > 0 ? (uint32_t)remaining : 0);
+        replay->wakeups++;
+        while(status == FuriStatusOk && running) {
+            running = replay_input(replay, &event);
+            status = furi_message_queue_get(queue, &event, 0);
+        }
+        replay_frame(replay);
+        if((int32_t)(furi_get_tick() - window_start) >= STATS_WINDOW) window_start = furi_get_tick();
+    }
+}
+
+void bench_input_latency(RenderBuffer* rb, TeapotCamera camera, RenderMode mode, uint8_t lod, int events) {
+    static const char* loop_names[2] = {"poll + delay", "blocking"};
+    double ticks_per_us = profiler_ticks_per_us();
+    printf("input-to-present latency, %d presses %s LOD %u:\n", events, render_mode_names[mode], lod);
+    for(int loop = 0; loop < 2; loop++) {
+        LoopReplay replay = {.rb = rb, .camera = camera, .mode = mode, .lod = lod};
+        InputFeed feed = {
+            .queue = furi_message_queue_alloc(EVENT_QUEUE_SIZE, sizeof(BenchEvent)),
+            .events = events,
+            .stop_after = INPUT_GAP_MAX,
+        };
+        FuriThread* thread = furi_thread_alloc_ex("InputFeed", 1024, input_feed, &feed);
+        furi_thread_start(thread);
+
+        if(loop == 0) {
+            replay_poll_loop(&replay, feed.queue);
+        } else {
+            replay_blocking_loop(&replay, feed.queue);
+        }
+
+        furi_thread_join(thread);
+        furi_thread_free(thread);
+        furi_message_queue_free(feed.queue);
+        printf(
+            "  %-13s min %.1f us, avg %.1f us, max %.1f us over %u frames\n",
+            loop_names[loop],
+            replay.latency.min / ticks_per_us,
+            frame_profile_avg(&replay.latency) / ticks_per_us,
+            replay.latency.max / ticks_per_us,
+            replay.renders);
+    }
+}
+
+void bench_idle(RenderBuffer* rb, TeapotCamera camera, RenderMode mode, uint8_t lod, int seconds) {
+    static const char* loop_names[2] = {"poll + delay", "blocking"};
+    printf("idle main loop, %d s %s LOD %u:\n", seconds, render_mode_names[mode], lod);
+    for(int loop = 0; loop < 2; loop++) {
+        // The view is already on screen
+        LoopReplay replay = {.rb = rb, .camera = camera, .mode = mode, .lod = lod};
+        replay_frame(&replay);
+        replay.renders = 0;
+
+        InputFeed feed = {
+            .queue = furi_message_queue_alloc(EVENT_QUEUE_SIZE, sizeof(BenchEvent)),
+            .events = 0,
+            .stop_after = (uint32_t)seconds * 1000,
+        };
+        FuriThread* thread = furi_thread_alloc_ex("InputFeed", 1024, input_feed, &feed);
+        furi_thread_start(thread);
+        uint64_t start = now_ns();
+        uint64_t cpu_start = thread_cpu_ns();
+
+        if(loop == 0) {
+            replay_poll_loop(&replay, feed.queue);
+        } else {
+            replay_blocking_loop(&replay, feed.queue);
+        }
+
+        double cpu_us = (thread_cpu_ns() - cpu_start) / 1000.0;
+        double wall_s = (now_ns() - start) / 1e9;
+        furi_thread_join(thread);
+        furi_thread_free(thread);
+        furi_message_queue_free(feed.queue);
+        printf(
+            "  %-13s %.1f wakeups/s, %u renders, %.1f us CPU/s (%.4f%%)\n",
+            loop_names[loop],
+            replay.wakeups / wall_s,
+            replay.renders,
+            cpu_us / wall_s,
+            cpu_us / wall_s / 1e4);
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef TEAPOT_HOST_BENCH_H
+#define TEAPOT_HOST_BENCH_H
+
+/*
+ * Host benchmarks that time an engine code path against a reference copy
+ * of the code it replaced, so the speedups claimed for those changes can be
+ * reproduced with `make bench`. The references live only here, the engine
+ * and the app never build them.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "teapot_engine.h"
+
+// Transform and project every vertex of level lod rounds times for a
+// frame in rb, turning the camera one auto-rotation step around axis per
+// round, with the three chained 4x4 rotations the renderer used before one
+// combined model matrix, and with the engine's transform stage. Prints ns
+// per vertex of both and how far their view and screen positions are apart.
+void bench_transform(RenderBuffer* rb, TeapotCamera camera, uint8_t lod, int axis, int rounds);
+
+// Draw count random lines of each class (shallow, diagonal and steep, from
+// a fixed seed, with ends up to a quarter of the buffer past its edges) into
+// a width x height buffer, with buffer_draw_line() and with the clipped
+// per-pixel Bresenham loop it replaced. Prints ns per line of both, best of
+// a few rounds, and fails when their pixels differ.
+bool bench_lines(uint16_t width, uint16_t height, int count);
+
+// Feed events presses of a key, at random gaps from a fixed seed and some
+// in bursts as held-key repeats queue up, to two replays of the app's main
+// loop: the one that polled the queue, handled one event and slept a frame,
+// and the one that sleeps on the queue and drains it. Both render inline
+// and record the input-to-present latency with the app's hook (event
+// stamped with profiler_ticks() when queued, timed when its frame is done).
+// Prints min/avg/max of both, rendering into rb.
+void bench_input_latency(RenderBuffer* rb, TeapotCamera camera, RenderMode mode, uint8_t lod, int events);
+
+// Run the same two loops for seconds with the view already drawn and no
+// input, as the app sits with auto-rotation off. Prints how often each
+// wakes, how many frames it renders and the CPU time of the loop's thread.
+void bench_idle(RenderBuffer* rb, TeapotCamera camera, RenderMode mode, uint8_t lod, int seconds);
+
+#endif // TEAPOT_HOST_BENCH_H
@@ -0,0 +1,634 @@
+/*
+ * Headless host build of the Smol Teapot renderer.
+ *
+ * Renders an auto-rotating teapot with the same engine code as the Flipper
+ * app, reports per-frame and per-stage timings and optionally writes frames
+ * as PBM images. With -t the frames are posted to the render thread the way
+ * the app does, using the pthread stand-ins for furi in host/furi_host.c.
+ * With -c it sweeps a full turn around each axis and reports how many
+ * triangle clusters, and triangles in them, were rejected whole. -l picks
+ * the level of detail, or lets the frame-time governor pick it with -l auto.
+ * -b renders the levels of a binary mesh asset, loaded the way the app
+ * loads it from the SD card.
+ * -X and -L time the vertex transform and the line drawer against the
+ * code they replaced, -P the input latency and -i the idle wakeups and CPU
+ * time of the main loop against the polling loop it replaced
+ * (host/teapot_bench.c). -d compares every frame with one written by -o,
+ * which `make check_fixed` uses to hold the fixed-point build to the float
+ * build's frames.
+ * Build with `make` from the repository root.
+ */
+#include "teapot_asset.h"
+#include "teapot_bench.h"
+#include "teapot_engine.h"
+#include "teapot_lod.h"
+#include "teapot_renderer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_FRAMES 360
+#define AUTO_ROTATE_SPEED 0.05f // Same step as the app's auto-rotation
+#define FULL_TURN 6.28318531f
+#define DEFAULT_TARGET_FPS 30
+#define LOD_AUTO -1
+#define DEFAULT_TOLERANCE 1 // Pixels the fixed-point pipeline may move an edge
+
+static void usage(const char* name) {
+    fprintf(
+        stderr,
+        "Usage: %s [options]\n"
+        "  -n FRAMES   frames to render (default %d)\n"
+        "  -m MODE     render mode: wire, sil, hide, fill (default wire)\n"
+        "  -a AXIS     auto-rotation axis: x, y, z (default y)\n"
+        "  -s SCALE    model scale, larger zooms in (default 2.0)\n"
+        "  -x X        model x position in view space, 0 centers it and past\n"
+        "              about 17 it is off screen (default 0)\n"
+        "  -l LEVEL    level of detail, 0 is the finest, or auto to let the\n"
+        "              frame-time governor pick it (default 0)\n"
+        "  -b FILE     render the levels of a binary mesh asset (teapot_asset.h)\n"
+        "              instead of the %d compiled-in ones\n"
+        "  -f FPS      governor target frame rate (default %d)\n"
+        "  -W WIDTH    buffer width, multiple of 8 (default %d)\n"
+        "  -H HEIGHT   buffer height (default %d)\n"
+        "  -o FILE     write PBM frames, a %%d in FILE expands to the frame\n"
+        "              number, otherwise only the last frame is written\n"
+        "  -d FILE     compare every frame with the PBM frames FILE names, as\n"
+        "              for -o, and fail when a set pixel of one is more than\n"
+        "              PIXELS from the nearest in the other\n"
+        "  -e PIXELS   tolerance of -d (default %d)\n"
+        "  -i SECONDS  then run the old polling main loop and the blocking one\n"
+        "              for SECONDS each with no input, and report their\n"
+        "              wakeups, renders and CPU time\n"
+        "  -t PERIOD   then post FRAMES cameras to the render thread, one every\n"
+        "              PERIOD us (0 posts as fast as possible), at a coarse\n"
+        "              LEVEL also wait for the still view to be refined\n"
+        "  -c STEPS    then render STEPS frames over a full turn around each\n"
+        "              axis and report the fraction of clusters and their\n"
+        "              triangles skipped\n"
+        "  -X ROUNDS   then transform and project every vertex of LEVEL ROUNDS\n"
+        "              times with the old three chained 4x4 rotations and with\n"
+        "              the engine's transform stage, and report ns per vertex\n"
+        "  -L COUNT    then draw COUNT random shallow, diagonal and steep lines\n"
+        "              each into a WIDTH x HEIGHT buffer with the line drawer\n"
+        "              and pixel by pixel, and report ns per line\n"
+        "  -P PRESSES  then replay PRESSES key presses through the old polling\n"
+        "              main loop and the blocking one, and report the\n"
+        "              input-to-present latency of both\n"
+        "  -v          print one line per frame\n",
+        name,
+        DEFAULT_FRAMES,
+        TEAPOT_LOD_COUNT,
+        DEFAULT_TARGET_FPS,
+        SCREEN_WIDTH,
+        SCREEN_HEIGHT,
+        DEFAULT_TOLERANCE);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Step the same way as the app's auto-rotation
+static void step_camera(TeapotCamera* camera, int axis) {
+    if(axis == 0) camera->rotation.x += AUTO_ROTATE_SPEED;
+    if(axis == 1) camera->rotation.y += AUTO_ROTATE_SPEED;
+    if(axis == 2) camera->rotation.z += AUTO_ROTATE_SPEED;
+}
+
+// Written by the render thread, read after it was joined
+typedef struct {
+    uint8_t lod; // Level of the posts
+    uint32_t renders;
+    uint64_t polygons;
+    uint32_t refines; // Frames redrawn at level 0 while the view was still
+    uint32_t refine_ticks; // Render time of the last of them
+    uint32_t refine_polygons;
+    Vec3f last_rotation; // Rotation of the final post
+    atomic_bool last_rendered; // The final post was rendered
+    atomic_bool last_refined; // And then refined
+} ThreadedStats;
+
+static void frame_rendered(const RenderRequest* request, const RenderStats* stats, void* context) {
+    ThreadedStats* threaded = context;
+    bool last = !memcmp(&request->camera.rotation, &threaded->last_rotation, sizeof(Vec3f));
+    if(request->lod != threaded->lod) {
+        threaded->refines++;
+        threaded->refine_ticks = 0;
+        for(int i = 0; i < ProfileStageBlit; i++) {
+            threaded->refine_ticks += stats->stage_ticks[i];
+        }
+        threaded->refine_polygons = stats->polygons_drawn;
+        if(last) atomic_store(&threaded->last_refined, true);
+        return;
+    }
+    threaded->renders++;
+    threaded->polygons += stats->polygons_drawn;
+    if(last) atomic_store(&threaded->last_rendered, true);
+}
+
+// Post cameras to the render thread like the app's main loop and report how
+// long posting takes and how many requests were coalesced
+static bool run_threaded(
+    TeapotCamera camera,
+    RenderMode mode,
+    uint8_t lod,
+    int axis,
+    int frames,
+    int width,
+    int height,
+    int period_us) {
+    TripleBuffer frame_buffers;
+    ThreadedStats threaded = {0};
+    TeapotCamera last = camera;
+    for(int frame = 1; frame < frames; frame++) {
+        step_camera(&last, axis);
+    }
+    threaded.lod = lod;
+    threaded.last_rotation = last.rotation;
+    atomic_init(&threaded.last_rendered, false);
+    atomic_init(&threaded.last_refined, false);
+    if(!triple_buffer_init(&frame_buffers, (uint16_t)width, (uint16_t)height)) {
+        fprintf(stderr, "Error: Out of memory\n");
+        return false;
+    }
+    TeapotRenderer* renderer =
+        teapot_renderer_alloc(&frame_buffers, 2048, FuriThreadPriorityLow, frame_rendered, &threaded);
+
+    uint64_t post_total = 0, post_min = UINT64_MAX, post_max = 0;
+    struct timespec period = {.tv_sec = period_us / 1000000, .tv_nsec = (long)(period_us % 1000000) * 1000};
+    uint64_t start = now_ns();
+    for(int frame = 0; frame < frames; frame++) {
+        RenderRequest request = {.camera = camera, .mode = mode, .lod = lod, .from_input = false};
+
+        uint64_t post_start = now_ns();
+        teapot_renderer_post(renderer, &request);
+        uint64_t elapsed = now_ns() - post_start;
+
+        post_total += elapsed;
+        if(elapsed < post_min) post_min = elapsed;
+        if(elapsed > post_max) post_max = elapsed;
+
+        step_camera(&camera, axis);
+        if(period_us > 0) nanosleep(&period, NULL);
+    }
+
+    // Only the newest request is rendered, wait for it before stopping
+    struct timespec poll = {.tv_sec = 0, .tv_nsec = 100000};
+    while(!atomic_load(&threaded.last_rendered)) {
+        nanosleep(&poll, NULL);
+    }
+    uint64_t wall = now_ns() - start;
+
+    // A coarse level is redrawn at level 0 once the view stays still
+    uint64_t refine_wait = 0;
+    if(lod != 0) {
+        uint64_t still = now_ns();
+        while(!atomic_load(&threaded.last_refined)) {
+            nanosleep(&poll, NULL);
+        }
+        refine_wait = now_ns() - still;
+    }
+
+    teapot_renderer_free(renderer);
+    triple_buffer_free(&frame_buffers);
+
+    printf(
+        "%d posts every %d us: %u renders (%.1f%% coalesced), post min %.2f us, avg %.2f us, "
+        "max %.2f us, %.1f polygons/render, %.1f ms wall\n",
+        frames,
+        period_us,
+        threaded.renders,
+        100.0 - threaded.renders * 100.0 / frames,
+        post_min / 1000.0,
+        post_total / 1000.0 / frames,
+        post_max / 1000.0,
+        threaded.renders ? (double)threaded.polygons / threaded.renders : 0.0,
+        wall / 1000000.0);
+    if(lod != 0) {
+        printf(
+            "%u refines to LOD 0, the still view after %.1f ms: %.1f us render, %u polygons\n",
+            threaded.refines,
+            refine_wait / 1000000.0,
+            (double)threaded.refine_ticks / profiler_ticks_per_us(),
+            threaded.refine_polygons);
+    }
+    return true;
+}
+
+// Render steps rotations evenly spread over a full turn around each axis
+static void run_cluster_sweep(RenderBuffer* rb, TeapotCamera camera, RenderMode mode, uint8_t lod, int steps) {
+    const char axis_names[3] = {'x', 'y', 'z'};
+    uint16_t cluster_count = teapot_lods[lod]->cluster_count;
+    uint16_t triangle_count = teapot_lods[lod]->triangle_count;
+    uint64_t total_skipped = 0;
+    uint64_t total_triangles = 0;
+    uint64_t total_us = 0;
+
+    printf("cluster sweep, %u clusters, %d steps per axis:", cluster_count, steps);
+    for(int axis = 0; axis < 3; axis++) {
+        uint64_t skipped = 0;
+        for(int step = 0; step < steps; step++) {
+            TeapotCamera turned = camera;
+            float angle = FULL_TURN * step / steps;
+            if(axis == 0) turned.rotation.x += angle;
+            if(axis == 1) turned.rotation.y += angle;
+            if(axis == 2) turned.rotation.z += angle;
+
+            RenderStats stats;
+            uint64_t start = now_ns();
+            render_complete_model(rb, &turned, mode, lod, &stats);
+            total_us += (now_ns() - start) / 1000;
+            skipped += stats.clusters_skipped;
+            total_triangles += stats.triangles_skipped;
+        }
+        total_skipped += skipped;
+        printf(" %c %.1f%%", axis_names[axis], 100.0 * skipped / ((double)cluster_count * steps));
+    }
+    printf(
+        ", all %.1f%% skipped (%.1f%% of triangles), %.1f us/frame\n",
+        100.0 * total_skipped / ((double)cluster_count * steps * 3),
+        100.0 * total_triangles / ((double)triangle_count * steps * 3),
+        (double)total_us / (steps * 3));
+}
+
+// PBM stores pixels MSB first, the render buffer LSB first
+static bool write_pbm(const char* path, const RenderBuffer* rb) {
+    FILE* out = fopen(path, "wb");
+    if(!out) {
+        fprintf(stderr, "Error: Cannot open output file %s\n", path);
+        return false;
+    }
+
+    fprintf(out, "P4\n%u %u\n", rb->width, rb->height);
+    size_t size = (rb->width / 8) * rb->height;
+    for(size_t i = 0; i < size; i++) {
+        uint8_t in = rb->buffer[i];
+        uint8_t reversed = 0;
+        for(int bit = 0; bit < 8; bit++) {
+            if(in & (1 << bit)) reversed |= 0x80 >> bit;
+        }
+        fputc(reversed, out);
+    }
+
+    fclose(out);
+    return true;
+}
+
+// Read a PBM written by write_pbm() into rb, which must have its size
+static bool read_pbm(const char* path, RenderBuffer* rb) {
+    FILE* in = fopen(path, "rb");
+    if(!in) {
+        fprintf(stderr, "Error: Cannot open reference frame %s\n", path);
+        return false;
+    }
+
+    unsigned width = 0, height = 0;
+    bool ok = fscanf(in, "P4 %u %u", &width, &height) == 2 && fgetc(in) == '\n' && width == rb->width &&
+              height == rb->height;
+    size_t size = (rb->width / 8) * rb->height;
+    for(size_t i = 0; ok && i < size; i++) {
+        int in_byte = fgetc(in);
+        if(in_byte == EOF) ok = false;
+        uint8_t reversed = 0;
+        for(int bit = 0; bit < 8; bit++) {
+            if(in_byte & (0x80 >> bit)) reversed |= 1 << bit;
+        }
+        rb->buffer[i] = reversed;
+    }
+
+    fclose(in);
+    if(!ok) fprintf(stderr, "Error: %s is not a %ux%u frame\n", path, rb->width, rb->height);
+    return ok;
+}
+
+static bool pixel_set(const RenderBuffer* rb, int x, int y) {
+    return rb->buffer[y * (rb->width / 8) + x / 8] & (1 << (x % 8));
+}
+
+// Farthest any set pixel of a lies from the nearest set pixel of b, in
+// pixels along x or y, whichever is larger. A pixel both have set is 0
+// away, and when b has none the distance is the buffer size.
+static int frame_displacement(const RenderBuffer* a, const RenderBuffer* b) {
+    int limit = a->width > a->height ? a->width : a->height;
+    int worst = 0;
+    for(int y = 0; y < a->height; y++) {
+        for(int x = 0; x < a->width; x++) {
+            if(!pixel_set(a, x, y) || pixel_set(b, x, y)) continue;
+            // Grow a square ring around the pixel until it meets one of b
+            int distance = 0;
+            bool found = false;
+            while(!found && distance < limit) {
+                distance++;
+                for(int ry = y - distance; ry <= y + distance && !found; ry++) {
+                    if(ry < 0 || ry >= b->height) continue;
+                    bool edge_row = ry == y - distance || ry == y + distance;
+                    for(int rx = x - distance; rx <= x + distance; rx += edge_row ? 1 : 2 * distance) {
+                        if(rx >= 0 && rx < b->width && pixel_set(b, rx, ry)) {
+                            found = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            if(distance > worst) worst = distance;
+        }
+    }
+    return worst;
+}
+
+static bool parse_mode(const char* name, RenderMode* mode) {
+    for(int i = 0; i < RenderModeCount; i++) {
+        const char* mode_name = render_mode_names[i];
+        size_t len = strlen(mode_name);
+        if(strlen(name) != len) continue;
+
+        bool match = true;
+        for(size_t j = 0; j < len; j++) {
+            char c = name[j];
+            if(c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
+            if(c != mode_name[j]) match = false;
+        }
+        if(match) {
+            *mode = (RenderMode)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    int frames = DEFAULT_FRAMES;
+    int idle_seconds = 0;
+    int period_us = -1; // No threaded run
+    int sweep_steps = 0;
+    int transform_rounds = 0;
+    int line_count = 0;
+    int presses = 0;
+    int fixed_lod = 0; // Or LOD_AUTO
+    int target_fps = DEFAULT_TARGET_FPS;
+    RenderMode mode = RenderModeWireframe;
+    int axis = 1;
+    int width = SCREEN_WIDTH;
+    int height = SCREEN_HEIGHT;
+    const char* output = NULL;
+    const char* reference = NULL;
+    int tolerance = DEFAULT_TOLERANCE;
+    const char* asset_path = NULL;
+    bool verbose = false;
+    TeapotCamera camera = {
+        .rotation = {0, 0, 0},
+        .position = {0, 0, 30},
+        .scale = 2.0f,
+    };
+
+    for(int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if(!strcmp(arg, "-v")) {
+            verbose = true;
+            continue;
+        }
+        if(arg[0] != '-' || !arg[1] || arg[2] || !value) {
+            usage(argv[0]);
+            return 1;
+        }
+        i++;
+
+        switch(arg[1]) {
+        case 'n':
+            frames = atoi(value);
+            break;
+        case 'm':
+            if(!parse_mode(value, &mode)) {
+                fprintf(stderr, "Error: Unknown render mode %s\n", value);
+                return 1;
+            }
+            break;
+        case 'a':
+            axis = value[0] - 'x';
+            break;
+        case 's':
+            camera.scale = (float)atof(value);
+            break;
+        case 'x':
+            camera.position.x = (float)atof(value);
+            break;
+        case 'W':
+            width = atoi(value);
+            break;
+        case 'H':
+            height = atoi(value);
+            break;
+        case 'o':
+            output = value;
+            break;
+        case 'd':
+            reference = value;
+            break;
+        case 'e':
+            tolerance = atoi(value);
+            break;
+        case 'b':
+            asset_path = value;
+            break;
+        case 'i':
+            idle_seconds = atoi(value);
+            break;
+        case 't':
+            period_us = atoi(value);
+            break;
+        case 'c':
+            sweep_steps = atoi(value);
+            break;
+        case 'X':
+            transform_rounds = atoi(value);
+            break;
+        case 'L':
+            line_count = atoi(value);
+            break;
+        case 'P':
+            presses = atoi(value);
+            break;
+        case 'l':
+            fixed_lod = strcmp(value, "auto") ? atoi(value) : LOD_AUTO;
+            break;
+        case 'f':
+            target_fps = atoi(value);
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Same arena size as the app, so an asset that loads here fits there
+    TeapotAsset asset;
+    uint8_t* asset_arena = NULL;
+    if(asset_path) {
+        asset_arena = malloc(TEAPOT_ASSET_ARENA_SIZE);
+        if(!asset_arena || !teapot_asset_load(&asset, asset_path, asset_arena, TEAPOT_ASSET_ARENA_SIZE)) {
+            fprintf(
+                stderr,
+                "Error: Cannot load %s, a missing or damaged file or one over %d bytes\n",
+                asset_path,
+                TEAPOT_ASSET_ARENA_SIZE);
+            return 1;
+        }
+        teapot_lods_use(asset.levels, asset.level_count);
+    }
+
+    if(frames <= 0 || idle_seconds < 0 || sweep_steps < 0 || transform_rounds < 0 || line_count < 0 || presses < 0 || fixed_lod < LOD_AUTO || fixed_lod >= teapot_lod_count ||
+       target_fps <= 0 || tolerance < 0 || axis < 0 || axis > 2 || width <= 0 || width % 8 || width > 0xFFF8 ||
+       height <= 0 || height > 0xFFFF) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    RenderBuffer rb, reference_rb = {0};
+    if(!render_buffer_init(&rb, (uint16_t)width, (uint16_t)height) || !teapot_engine_init((uint16_t)width, (uint16_t)height) ||
+       (reference && !render_buffer_init(&reference_rb, (uint16_t)width, (uint16_t)height))) {
+        fprintf(stderr, "Error: Out of memory\n");
+        return 1;
+    }
+
+    bool per_frame_output = output && strchr(output, '%');
+    uint64_t total_ns = 0, min_ns = UINT64_MAX, max_ns = 0;
+    uint64_t total_polygons = 0;
+    FrameProfile profile;
+    frame_profile_reset(&profile);
+    LodGovernor governor;
+    lod_governor_init(&governor, (uint32_t)target_fps);
+    uint8_t lod = fixed_lod == LOD_AUTO ? governor.lod : (uint8_t)fixed_lod;
+    uint32_t lod_frames[TEAPOT_LOD_MAX] = {0};
+    uint32_t lod_switches = 0;
+    int worst_displacement = 0, worst_frame = 0;
+    uint32_t frames_differing = 0;
+
+    for(int frame = 0; frame < frames; frame++) {
+        RenderStats stats;
+
+        uint64_t start = now_ns();
+        render_complete_model(&rb, &camera, mode, lod, &stats);
+        uint64_t elapsed = now_ns() - start;
+        lod_frames[lod]++;
+
+        total_ns += elapsed;
+        if(elapsed < min_ns) min_ns = elapsed;
+        if(elapsed > max_ns) max_ns = elapsed;
+        total_polygons += stats.polygons_drawn;
+        for(int stage = 0; stage < ProfileStageBlit; stage++) {
+            frame_profile_add(&profile, (ProfileStage)stage, stats.stage_ticks[stage]);
+        }
+
+        if(verbose) {
+            printf("frame %d: %.1f us, %u polygons, LOD %u\n", frame, elapsed / 1000.0, stats.polygons_drawn, lod);
+        }
+        if(per_frame_output) {
+            char path[256];
+            snprintf(path, sizeof(path), output, frame);
+            if(!write_pbm(path, &rb)) return 1;
+        }
+        if(reference) {
+            char path[256];
+            snprintf(path, sizeof(path), reference, frame);
+            if(!read_pbm(path, &reference_rb)) return 1;
+            // Both ways, a pixel one frame lost counts as much as one it
+            // gained
+            int displacement = frame_displacement(&rb, &reference_rb);
+            int back = frame_displacement(&reference_rb, &rb);
+            if(back > displacement) displacement = back;
+            if(displacement > 0) frames_differing++;
+            if(displacement > worst_displacement) {
+                worst_displacement = displacement;
+                worst_frame = frame;
+            }
+        }
+
+        // Same input as the app's governor: the render time of this frame
+        if(fixed_lod == LOD_AUTO) {
+            uint32_t render_ticks = 0;
+            for(int stage = 0; stage < ProfileStageBlit; stage++) {
+                render_ticks += stats.stage_ticks[stage];
+            }
+            uint8_t next = lod_governor_update(&governor, render_ticks);
+            if(next != lod) lod_switches++;
+            lod = next;
+        }
+
+        step_camera(&camera, axis);
+    }
+
+    if(output && !per_frame_output && !write_pbm(output, &rb)) return 1;
+
+    printf(
+        "%d frames %dx%d %s: min %.1f us, avg %.1f us, max %.1f us, %.1f polygons/frame\n",
+        frames,
+        width,
+        height,
+        render_mode_names[mode],
+        min_ns / 1000.0,
+        total_ns / 1000.0 / frames,
+        max_ns / 1000.0,
+        (double)total_polygons / frames);
+    printf("frames per LOD (finest first):");
+    for(int level = 0; level < teapot_lod_count; level++) {
+        printf(" %s %u", teapot_lods[level]->name, lod_frames[level]);
+    }
+    if(fixed_lod == LOD_AUTO) {
+        printf(", %u switches at %d fps", lod_switches, target_fps);
+    }
+    printf("\n");
+
+    // There is no canvas to blit to, so the blit stage has no samples
+    double ticks_per_us = profiler_ticks_per_us();
+    printf("stage      min us   avg us   max us\n");
+    for(int stage = 0; stage < ProfileStageCount; stage++) {
+        const ProfileStageStats* stats = &profile.stages[stage];
+        if(!stats->samples) continue;
+        printf(
+            "%-8s %8.1f %8.1f %8.1f\n",
+            profile_stage_names[stage],
+            stats->min / ticks_per_us,
+            frame_profile_avg(stats) / ticks_per_us,
+            stats->max / ticks_per_us);
+    }
+
+    if(reference) {
+        printf(
+            "%u of %d frames differ from %s, worst displacement %d pixels (frame %d), tolerance %d\n",
+            frames_differing,
+            frames,
+            reference,
+            worst_displacement,
+            worst_frame,
+            tolerance);
+        if(worst_displacement > tolerance) {
+            fprintf(stderr, "Error: Frame %d is %d pixels off, over the tolerance\n", worst_frame, worst_displacement);
+            return 1;
+        }
+    }
+
+    if(sweep_steps > 0) run_cluster_sweep(&rb, camera, mode, lod, sweep_steps);
+
+    if(transform_rounds > 0) bench_transform(&rb, camera, lod, axis, transform_rounds);
+
+    if(line_count > 0 && !bench_lines((uint16_t)width, (uint16_t)height, line_count)) return 1;
+
+    if(presses > 0) bench_input_latency(&rb, camera, mode, lod, presses);
+
+    if(idle_seconds > 0) bench_idle(&rb, camera, mode, lod, idle_seconds);
+
+    if(period_us >= 0 && !run_threaded(camera, mode, lod, axis, frames, width, height, period_us)) return 1;
+
+    teapot_engine_free();
+    render_buffer_free(&rb);
+    render_buffer_free(&reference_rb);
+    free(asset_arena);
+    return 0;
+}
@@ -0,0 +1,1756 @@
+/*
+ * Convert a triangulated Wavefront OBJ model into a C header for Smol Teapot.
+ *
+ * The header holds the unique vertex positions once, plus a uint16 index
+ * array with three indices per triangle, so the renderer can transform each
+ * shared vertex a single time per frame. It also lists every unique edge
+ * with its two adjacent triangles, so shared edges are drawn only once, and
+ * flags crease edges whose dihedral angle exceeds a threshold, and stores
+ * each triangle's unit normal and plane offset so faces can be culled in
+ * model space before any of their vertices are transformed. Triangles are
+ * grouped into clusters of neighbours with similar normals, each with a
+ * bounding sphere and normal cone, so whole back-facing clusters can be
+ * rejected with one test.
+ *
+ * The model is moved so the center of its bounding box is the origin, the
+ * renderer's rotation pivot, and vertex positions are stored as int16 steps
+ * of one scale shared by all axes, which halves the flash they take. The
+ * renderer folds the scale into its model transform. Planes and bounds are
+ * computed from the quantized positions, so culling agrees with what is
+ * drawn. The header also records the model's bounding box, surface centroid
+ * and bounding sphere.
+ *
+ * With -l the model is decimated by quadric error edge collapse into a chain
+ * of levels of detail, one per descending triangle count, each continuing
+ * from the one before. Symbols are prefixed with the output file name and,
+ * past level 0, the level (teapot.h gives teapot_vertices and
+ * teapot_lod2_vertices, TEAPOT_LOD2_VERTEX_COUNT), each level ends with a
+ * TeapotMesh (teapot_mesh.h) that points at its arrays and the header with
+ * a teapot_levels array of the meshes, finest first. With -b the same levels
+ * go to a binary mesh asset (teapot_asset.h) that the app loads from the SD
+ * card instead.
+ *
+ * The OBJ file is read once in fixed-size chunks and parsed in place, with
+ * a hand-written number parser instead of sscanf, into arrays that grow as
+ * needed, so the input size is only limited by memory for the mesh itself.
+ * Polygons with more than three corners are split into a triangle fan. The
+ * generated header still needs uint16 indices. With -p the converter parses
+ * (and with -l decimates) a file without converting it and reports the
+ * throughput.
+ *
+ * Build: cc -O2 -o obj_to_header obj_to_teapot_header.c -lm
+ * Usage: ./obj_to_header [-b] [-l TRIANGLES,...] input.obj output [crease_angle_degrees]
+ *        ./obj_to_header -p [-l TRIANGLES,...] input.obj
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "teapot_asset.h"
+
+#define MAX_INDEX 0xFFFF
+#define READ_CHUNK 65536 // Bytes read from the OBJ file at a time
+#define NO_FACE -1 // Second face of a border edge
+#define HEADER_NO_FACE 0xFFFF // TEAPOT_NO_FACE in the generated header
+#define DEFAULT_CREASE_ANGLE 45.0f // Degrees between adjacent face normals
+#define EDGE_CREASE 0x01
+#define CLUSTER_MAX_TRIANGLES 64
+#define CLUSTER_MAX_ANGLE 30.0f // Degrees between a face and the cluster's mean normal
+#define CLUSTER_MIN_TRIANGLES 8 // Smaller clusters merge into a neighbour
+#define CLUSTER_MERGE_ANGLE 45.0f // Widest normal cone a merge may give
+#define MAX_NEIGHBORS 3
+#define QUANTIZED_MAX 32767 // Quantized coordinates span -QUANTIZED_MAX..QUANTIZED_MAX
+#define MAX_LEVELS TEAPOT_ASSET_MAX_LEVELS // Levels of detail in one header or asset
+
+typedef struct {
+    float x, y, z;
+} Vertex;
+
+typedef struct {
+    int v1, v2, v3;
+} Face;
+
+typedef struct {
+    int v1, v2; // v1 < v2
+    int f1, f2; // Adjacent faces, f2 is NO_FACE on open borders
+    int flags; // EDGE_CREASE
+} Edge;
+
+static Vertex* vertices;
+static int vertex_count = 0;
+static int vertex_capacity = 0;
+static int16_t (*quantized)[3];
+static float quantize_scale; // Model units per quantization step
+static Vertex input_center; // Bounding box center in the input, moved to the origin
+static Vertex bounds_min, bounds_max;
+static Vertex centroid; // Area-weighted centroid of the surface
+static Vertex sphere_center;
+static float sphere_radius;
+static Face* faces;
+static int face_count = 0;
+static int face_capacity = 0;
+static Edge* edges;
+static int* edge_hash; // Edge index + 1, 0 marks an empty slot
+static unsigned int edge_hash_mask; // Hash size - 1, the size is a power of two
+static int edge_count = 0;
+
+typedef struct {
+    int first, count; // Range in faces after clustering
+    Vertex center;
+    float radius;
+    Vertex axis; // Mean unit normal
+    float cone_cos, cone_sin; // Half-angle of the normal cone around axis
+} Cluster;
+
+static Cluster* clusters;
+static int cluster_count = 0;
+static int* face_cluster; // Cluster of each face, -1 while unassigned
+static Vertex* face_normals; // Unit normal of each face while clustering
+static int (*face_neighbors)[MAX_NEIGHBORS];
+static int* face_neighbor_count;
+
+static void* allocate(size_t size) {
+    void* data = malloc(size ? size : 1);
+    if(!data) {
+        fprintf(stderr, "Error: Out of memory allocating %zu bytes\n", size);
+        exit(1);
+    }
+    return data;
+}
+
+// Make room for one more element, doubling the capacity when full
+static void* grow(void* data, int count, int* capacity, size_t element_size) {
+    if(count < *capacity) return data;
+    *capacity = *capacity ? *capacity * 2 : 1024;
+    data = realloc(data, element_size * *capacity);
+    if(!data) {
+        fprintf(stderr, "Error: Out of memory growing to %d elements\n", *capacity);
+        exit(1);
+    }
+    return data;
+}
+
+static int16_t quantize_coord(float v, float offset) {
+    long q = lroundf((v - offset) / quantize_scale);
+    if(q < -QUANTIZED_MAX) q = -QUANTIZED_MAX;
+    if(q > QUANTIZED_MAX) q = QUANTIZED_MAX;
+    return (int16_t)q;
+}
+
+// Center of the input's bounding box, the origin of every level
+static Vertex bounding_box_center(void) {
+    Vertex lo = vertices[0], hi = vertices[0];
+    for(int i = 1; i < vertex_count; i++) {
+        if(vertices[i].x < lo.x) lo.x = vertices[i].x;
+        if(vertices[i].y < lo.y) lo.y = vertices[i].y;
+        if(vertices[i].z < lo.z) lo.z = vertices[i].z;
+        if(vertices[i].x > hi.x) hi.x = vertices[i].x;
+        if(vertices[i].y > hi.y) hi.y = vertices[i].y;
+        if(vertices[i].z > hi.z) hi.z = vertices[i].z;
+    }
+    return (Vertex){(lo.x + hi.x) / 2, (lo.y + hi.y) / 2, (lo.z + hi.z) / 2};
+}
+
+// Move the model so input_center is the origin, pick one step size for the
+// farthest reach from it along any axis and move every vertex to its
+// quantized position. Levels of one chain share the center, so they line
+// up when the renderer switches between them.
+static void quantize_vertices(void) {
+    float reach = 0;
+    for(int i = 0; i < vertex_count; i++) {
+        reach = fmaxf(reach, fabsf(vertices[i].x - input_center.x));
+        reach = fmaxf(reach, fabsf(vertices[i].y - input_center.y));
+        reach = fmaxf(reach, fabsf(vertices[i].z - input_center.z));
+    }
+    quantize_scale = reach > 0 ? reach / QUANTIZED_MAX : 1;
+    quantized = allocate(sizeof(*quantized) * vertex_count);
+
+    for(int i = 0; i < vertex_count; i++) {
+        Vertex* v = &vertices[i];
+        quantized[i][0] = quantize_coord(v->x, input_center.x);
+        quantized[i][1] = quantize_coord(v->y, input_center.y);
+        quantized[i][2] = quantize_coord(v->z, input_center.z);
+        v->x = quantized[i][0] * quantize_scale;
+        v->y = quantized[i][1] * quantize_scale;
+        v->z = quantized[i][2] * quantize_scale;
+    }
+}
+
+static float distance(Vertex a, Vertex b) {
+    Vertex d = {a.x - b.x, a.y - b.y, a.z - b.z};
+    return sqrtf(d.x * d.x + d.y * d.y + d.z * d.z);
+}
+
+// Bounding box, surface centroid and bounding sphere of the centered model.
+// The sphere is the smaller of the one around the box center and Ritter's:
+// start with the two vertices farthest apart along a sweep, then grow the
+// sphere just enough to take in each vertex left outside.
+static void compute_bounds(void) {
+    bounds_min = bounds_max = vertices[0];
+    for(int i = 1; i < vertex_count; i++) {
+        Vertex p = vertices[i];
+        if(p.x < bounds_min.x) bounds_min.x = p.x;
+        if(p.y < bounds_min.y) bounds_min.y = p.y;
+        if(p.z < bounds_min.z) bounds_min.z = p.z;
+        if(p.x > bounds_max.x) bounds_max.x = p.x;
+        if(p.y > bounds_max.y) bounds_max.y = p.y;
+        if(p.z > bounds_max.z) bounds_max.z = p.z;
+    }
+
+    double area_sum = 0, cx = 0, cy = 0, cz = 0;
+    for(int i = 0; i < face_count; i++) {
+        Vertex a = vertices[faces[i].v1], b = vertices[faces[i].v2], c = vertices[faces[i].v3];
+        Vertex u = {b.x - a.x, b.y - a.y, b.z - a.z};
+        Vertex v = {c.x - a.x, c.y - a.y, c.z - a.z};
+        Vertex n = {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+        double area = sqrt(n.x * n.x + n.y * n.y + n.z * n.z) / 2;
+        area_sum += area;
+        cx += area * (a.x + b.x + c.x) / 3;
+        cy += area * (a.y + b.y + c.y) / 3;
+        cz += area * (a.z + b.z + c.z) / 3;
+    }
+    centroid = area_sum > 0 ? (Vertex){cx / area_sum, cy / area_sum, cz / area_sum} :
+                              (Vertex){0, 0, 0};
+
+    Vertex box_center = {
+        (bounds_min.x + bounds_max.x) / 2,
+        (bounds_min.y + bounds_max.y) / 2,
+        (bounds_min.z + bounds_max.z) / 2,
+    };
+    float box_radius = 0;
+    for(int i = 0; i < vertex_count; i++) {
+        float d = distance(vertices[i], box_center);
+        if(d > box_radius) box_radius = d;
+    }
+
+    Vertex a = vertices[0], b = a;
+    float far = 0;
+    for(int i = 0; i < vertex_count; i++) {
+        float d = distance(vertices[i], vertices[0]);
+        if(d > far) {
+            far = d;
+            a = vertices[i];
+        }
+    }
+    far = 0;
+    for(int i = 0; i < vertex_count; i++) {
+        float d = distance(vertices[i], a);
+        if(d > far) {
+            far = d;
+            b = vertices[i];
+        }
+    }
+    Vertex center = {(a.x + b.x) / 2, (a.y + b.y) / 2, (a.z + b.z) / 2};
+    float radius = far / 2;
+    for(int i = 0; i < vertex_count; i++) {
+        float d = distance(vertices[i], center);
+        if(d <= radius) continue;
+        // Move the center towards the vertex so the far side stays put
+        float grown = (radius + d) / 2;
+        float t = (grown - radius) / d;
+        center.x += (vertices[i].x - center.x) * t;
+        center.y += (vertices[i].y - center.y) * t;
+        center.z += (vertices[i].z - center.z) * t;
+        radius = grown;
+    }
+
+    if(radius < box_radius) {
+        sphere_center = center;
+        sphere_radius = radius;
+    } else {
+        sphere_center = box_center;
+        sphere_radius = box_radius;
+    }
+    // Float rounding of the moved centers must not leave a vertex outside
+    for(int i = 0; i < vertex_count; i++) {
+        float d = distance(vertices[i], sphere_center);
+        if(d > sphere_radius) sphere_radius = d;
+    }
+}
+
+// Record that face f uses edge (a, b), merging it with the other face
+// already sharing that edge
+static void add_edge(int a, int b, int f) {
+    int v1 = a < b ? a : b;
+    int v2 = a < b ? b : a;
+    unsigned int slot = ((unsigned int)v1 * 73856093u ^ (unsigned int)v2 * 19349663u) & edge_hash_mask;
+
+    while(edge_hash[slot]) {
+        Edge* e = &edges[edge_hash[slot] - 1];
+        // Non-manifold edges shared by more than two faces get a new entry
+        if(e->v1 == v1 && e->v2 == v2 && e->f2 == NO_FACE) {
+            e->f2 = f;
+            return;
+        }
+        slot = (slot + 1) & edge_hash_mask;
+    }
+
+    Edge* e = &edges[edge_count];
+    e->v1 = v1;
+    e->v2 = v2;
+    e->f1 = f;
+    e->f2 = NO_FACE;
+    e->flags = 0;
+    edge_hash[slot] = ++edge_count;
+}
+
+// List every unique edge of the faces, replacing any previous list
+static void build_edges(void) {
+    free(edges);
+    free(edge_hash);
+    edge_count = 0;
+
+    // Every triangle adds at most three edges, the hash stays at most half full
+    unsigned int hash_size = 1;
+    while(hash_size < (unsigned int)face_count * 6) hash_size *= 2;
+    edge_hash_mask = hash_size - 1;
+    edge_hash = calloc(hash_size, sizeof(int));
+    if(!edge_hash) {
+        fprintf(stderr, "Error: Out of memory for the edge hash\n");
+        exit(1);
+    }
+    edges = allocate(sizeof(Edge) * face_count * 3);
+    for(int i = 0; i < face_count; i++) {
+        add_edge(faces[i].v1, faces[i].v2, i);
+        add_edge(faces[i].v2, faces[i].v3, i);
+        add_edge(faces[i].v3, faces[i].v1, i);
+    }
+}
+
+static Vertex face_normal(const Face* f) {
+    Vertex a = vertices[f->v1], b = vertices[f->v2], c = vertices[f->v3];
+    Vertex u = {b.x - a.x, b.y - a.y, b.z - a.z};
+    Vertex v = {c.x - a.x, c.y - a.y, c.z - a.z};
+    Vertex n = {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+    float len = sqrtf(n.x * n.x + n.y * n.y + n.z * n.z);
+    if(len > 0.0f) {
+        n.x /= len;
+        n.y /= len;
+        n.z /= len;
+    }
+    return n;
+}
+
+static float dot(Vertex a, Vertex b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static void add_neighbor(int f, int neighbor) {
+    if(face_neighbor_count[f] < MAX_NEIGHBORS) {
+        face_neighbors[f][face_neighbor_count[f]++] = neighbor;
+    }
+}
+
+// Mean normal of the faces in cluster c, plus other when it is not -1, into
+// axis. Returns the cosine of the widest angle between a face and the axis.
+static float cluster_cone(int c, int other, Vertex* axis) {
+    Vertex sum = {0, 0, 0};
+    for(int i = 0; i < face_count; i++) {
+        if(face_cluster[i] != c && face_cluster[i] != other) continue;
+        sum.x += face_normals[i].x;
+        sum.y += face_normals[i].y;
+        sum.z += face_normals[i].z;
+    }
+    float len = sqrtf(dot(sum, sum));
+    if(len == 0.0f) {
+        *axis = (Vertex){0, 0, 1};
+        return -1.0f;
+    }
+    *axis = (Vertex){sum.x / len, sum.y / len, sum.z / len};
+    float cone_cos = 1.0f;
+    for(int i = 0; i < face_count; i++) {
+        if(face_cluster[i] != c && face_cluster[i] != other) continue;
+        float d = dot(face_normals[i], *axis);
+        if(d < cone_cos) cone_cos = d;
+    }
+    return cone_cos;
+}
+
+// Move the faces of cluster from into cluster to, leaving from empty
+static void move_cluster(int from, int to) {
+    for(int i = 0; i < face_count; i++) {
+        if(face_cluster[i] == from) face_cluster[i] = to;
+    }
+    clusters[to].count += clusters[from].count;
+    clusters[from].count = 0;
+}
+
+// Merge every cluster below CLUSTER_MIN_TRIANGLES into the edge-connected
+// cluster that gives the narrowest merged cone, smallest first, while the
+// cone stays within CLUSTER_MERGE_ANGLE and the size within
+// CLUSTER_MAX_TRIANGLES. On coarse levels neighbouring faces bend further
+// apart than CLUSTER_MAX_ANGLE, so growing alone leaves clusters of a few
+// triangles that cost a cone test each and save hardly any face tests.
+static void merge_small_clusters(void) {
+    float min_dot = cosf(CLUSTER_MERGE_ANGLE * 3.14159265f / 180.0f);
+    bool* stuck = allocate(sizeof(bool) * cluster_count);
+    for(int c = 0; c < cluster_count; c++) {
+        stuck[c] = false;
+    }
+
+    for(;;) {
+        int small = -1;
+        for(int c = 0; c < cluster_count; c++) {
+            if(stuck[c] || clusters[c].count == 0 || clusters[c].count >= CLUSTER_MIN_TRIANGLES) continue;
+            if(small < 0 || clusters[c].count < clusters[small].count) small = c;
+        }
+        if(small < 0) break;
+
+        int best = -1;
+        float best_dot = min_dot;
+        for(int i = 0; i < face_count; i++) {
+            if(face_cluster[i] != small) continue;
+            for(int j = 0; j < face_neighbor_count[i]; j++) {
+                int other = face_cluster[face_neighbors[i][j]];
+                if(other == small || other == best) continue;
+                if(clusters[small].count + clusters[other].count > CLUSTER_MAX_TRIANGLES) continue;
+                Vertex axis;
+                float d = cluster_cone(small, other, &axis);
+                if(d >= best_dot) {
+                    best_dot = d;
+                    best = other;
+                }
+            }
+        }
+        if(best < 0) {
+            stuck[small] = true;
+            continue;
+        }
+        move_cluster(small, best);
+        // If still small, the merged cluster gets another try with its new axis
+        stuck[best] = false;
+    }
+
+    // What is left sits on sharp features with no neighbour close enough:
+    // gather it into one cluster that is tested once and never skipped,
+    // instead of a test per fragment of one or two faces
+    int rest = -1;
+    for(int c = 0; c < cluster_count; c++) {
+        if(clusters[c].count == 0 || clusters[c].count >= CLUSTER_MIN_TRIANGLES) continue;
+        if(rest < 0) {
+            rest = c;
+        } else {
+            move_cluster(c, rest);
+        }
+    }
+
+    // Renumber the remaining clusters in order
+    int* renumber = allocate(sizeof(int) * cluster_count);
+    int kept = 0;
+    for(int c = 0; c < cluster_count; c++) {
+        renumber[c] = kept;
+        if(clusters[c].count > 0) clusters[kept++].count = clusters[c].count;
+    }
+    for(int i = 0; i < face_count; i++) {
+        face_cluster[i] = renumber[face_cluster[i]];
+    }
+    cluster_count = kept;
+    free(renumber);
+    free(stuck);
+}
+
+// Grow clusters of edge-connected faces: starting from the first unassigned
+// face, keep adding the frontier face closest to the cluster's mean normal
+// while it stays within CLUSTER_MAX_ANGLE, then merge the small ones
+static void build_clusters(void) {
+    // Every face of a cluster adds at most MAX_NEIGHBORS to the frontier
+    static int frontier[CLUSTER_MAX_TRIANGLES * MAX_NEIGHBORS];
+    float min_dot = cosf(CLUSTER_MAX_ANGLE * 3.14159265f / 180.0f);
+
+    clusters = allocate(sizeof(Cluster) * face_count);
+    face_cluster = allocate(sizeof(int) * face_count);
+    face_normals = allocate(sizeof(Vertex) * face_count);
+    face_neighbors = allocate(sizeof(*face_neighbors) * face_count);
+    face_neighbor_count = allocate(sizeof(int) * face_count);
+    for(int i = 0; i < face_count; i++) {
+        face_cluster[i] = -1;
+        face_normals[i] = face_normal(&faces[i]);
+        face_neighbor_count[i] = 0;
+    }
+    for(int i = 0; i < edge_count; i++) {
+        if(edges[i].f2 == NO_FACE) continue;
+        add_neighbor(edges[i].f1, edges[i].f2);
+        add_neighbor(edges[i].f2, edges[i].f1);
+    }
+
+    for(int seed = 0; seed < face_count; seed++) {
+        if(face_cluster[seed] >= 0) continue;
+
+        int c = cluster_count++;
+        int size = 0;
+        int frontier_count = 0;
+        Vertex sum = {0, 0, 0};
+        int f = seed;
+
+        for(;;) {
+            face_cluster[f] = c;
+            size++;
+            Vertex n = face_normals[f];
+            sum.x += n.x;
+            sum.y += n.y;
+            sum.z += n.z;
+            for(int j = 0; j < face_neighbor_count[f]; j++) {
+                frontier[frontier_count++] = face_neighbors[f][j];
+            }
+            if(size == CLUSTER_MAX_TRIANGLES) break;
+
+            // Best unassigned frontier face against the current mean normal
+            float len = sqrtf(dot(sum, sum));
+            int best = -1;
+            float best_dot = min_dot;
+            for(int j = 0; j < frontier_count; j++) {
+                int candidate = frontier[j];
+                if(face_cluster[candidate] >= 0) continue;
+                float d = dot(face_normals[candidate], sum) / len;
+                if(d >= best_dot) {
+                    best_dot = d;
+                    best = candidate;
+                }
+            }
+            if(best < 0) break;
+            f = best;
+        }
+        clusters[c].count = size;
+    }
+    merge_small_clusters();
+
+    for(int c = 0; c < cluster_count; c++) {
+        Cluster* cluster = &clusters[c];
+
+        // Normal cone around the mean normal
+        float cone_cos = cluster_cone(c, -1, &cluster->axis);
+        if(cone_cos <= 0.0f) {
+            // Normals span a half-space, cone_cos 0 and cone_sin 1 make the
+            // cluster test always fail
+            cluster->cone_cos = 0.0f;
+            cluster->cone_sin = 1.0f;
+        } else {
+            cluster->cone_cos = cone_cos;
+            cluster->cone_sin = sqrtf(1.0f - cone_cos * cone_cos);
+        }
+
+        // Bounding sphere around the center of the vertex bounding box
+        bool first = true;
+        Vertex lo = {0, 0, 0}, hi = lo;
+        for(int i = 0; i < face_count; i++) {
+            if(face_cluster[i] != c) continue;
+            int v[3] = {faces[i].v1, faces[i].v2, faces[i].v3};
+            for(int k = 0; k < 3; k++) {
+                Vertex p = vertices[v[k]];
+                if(first) {
+                    lo = hi = p;
+                    first = false;
+                }
+                if(p.x < lo.x) lo.x = p.x;
+                if(p.y < lo.y) lo.y = p.y;
+                if(p.z < lo.z) lo.z = p.z;
+                if(p.x > hi.x) hi.x = p.x;
+                if(p.y > hi.y) hi.y = p.y;
+                if(p.z > hi.z) hi.z = p.z;
+            }
+        }
+        cluster->center = (Vertex){(lo.x + hi.x) / 2, (lo.y + hi.y) / 2, (lo.z + hi.z) / 2};
+        cluster->radius = 0.0f;
+        for(int i = 0; i < face_count; i++) {
+            if(face_cluster[i] != c) continue;
+            int v[3] = {faces[i].v1, faces[i].v2, faces[i].v3};
+            for(int k = 0; k < 3; k++) {
+                Vertex p = vertices[v[k]];
+                Vertex d = {p.x - cluster->center.x, p.y - cluster->center.y, p.z - cluster->center.z};
+                float dist = sqrtf(dot(d, d));
+                if(dist > cluster->radius) cluster->radius = dist;
+            }
+        }
+    }
+    free(face_normals);
+}
+
+// Reorder faces so every cluster is a contiguous range, and renumber the
+// edges' face references to match
+static void sort_faces_by_cluster(void) {
+    Face* sorted = allocate(sizeof(Face) * face_count);
+    int* new_index = allocate(sizeof(int) * face_count);
+    int* next = allocate(sizeof(int) * cluster_count);
+
+    int first = 0;
+    for(int c = 0; c < cluster_count; c++) {
+        clusters[c].first = first;
+        first += clusters[c].count;
+    }
+
+    for(int c = 0; c < cluster_count; c++) {
+        next[c] = clusters[c].first;
+    }
+    for(int i = 0; i < face_count; i++) {
+        int slot = next[face_cluster[i]]++;
+        sorted[slot] = faces[i];
+        new_index[i] = slot;
+    }
+    memcpy(faces, sorted, sizeof(Face) * face_count);
+
+    for(int i = 0; i < edge_count; i++) {
+        edges[i].f1 = new_index[edges[i].f1];
+        if(edges[i].f2 != NO_FACE) edges[i].f2 = new_index[edges[i].f2];
+    }
+    free(sorted);
+    free(new_index);
+    free(next);
+}
+
+// Flag edges whose adjacent faces bend by more than the crease angle
+static int flag_creases(float crease_angle) {
+    float min_dot = cosf(crease_angle * 3.14159265f / 180.0f);
+    int crease_count = 0;
+
+    for(int i = 0; i < edge_count; i++) {
+        Edge* e = &edges[i];
+        if(e->f2 == NO_FACE) continue;
+
+        Vertex n1 = face_normal(&faces[e->f1]);
+        Vertex n2 = face_normal(&faces[e->f2]);
+        if(n1.x * n2.x + n1.y * n2.y + n1.z * n2.z < min_dot) {
+            e->flags |= EDGE_CREASE;
+            crease_count++;
+        }
+    }
+
+    return crease_count;
+}
+
+/*
+ * Quadric error metric decimation (Garland and Heckbert). Every vertex
+ * carries the sum of the squared distances to the planes of its faces,
+ * weighted by face area, as a symmetric 4x4 matrix. Edges are collapsed
+ * cheapest first into the point that minimizes the merged quadric, from a
+ * heap whose stale entries are recognized by vertex version numbers. Border
+ * edges add a plane at right angles to their face, so open borders keep
+ * their shape. A collapse that would fold a face over or pinch two sheets
+ * of the mesh together is skipped.
+ */
+
+#define BORDER_WEIGHT 100.0 // Border planes against face planes of the same area
+#define HEAP_MIN_COMPACT 4096 // Heap entries below which compaction is not worth it
+#define FOLD_MIN_COS 0.2 // Smallest cosine between a face's normals before and after a collapse
+
+typedef struct {
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+} Quadric;
+
+typedef struct {
+    float cost;
+    int v1, v2;
+    uint32_t version1, version2; // Vertex versions the cost was computed for
+} Collapse;
+
+// One level of detail, compacted out of the decimated mesh
+typedef struct {
+    Vertex* vertices;
+    int vertex_count;
+    Face* faces;
+    int face_count;
+} Level;
+
+static Quadric* quadrics;
+static uint32_t* vertex_version; // Bumped on every change of the vertex
+static unsigned char* face_removed;
+static int* vertex_corners; // First corner (face * 3 + k) of each vertex, -1 when none
+static int* corner_next; // Next corner of the same vertex, -1 at the end
+static int* vertex_mark; // Stamps for neighbor sets
+static int mark_stamp = 0;
+static int* neighbors;
+static int neighbor_count = 0;
+static int neighbor_capacity = 0;
+static Collapse* heap;
+static int heap_count = 0;
+static int heap_capacity = 0;
+
+static int* corner_vertex(int corner) {
+    Face* f = &faces[corner / 3];
+    return corner % 3 == 0 ? &f->v1 : corner % 3 == 1 ? &f->v2 : &f->v3;
+}
+
+static void quadric_add_plane(Quadric* q, double a, double b, double c, double d, double weight) {
+    q->a2 += weight * a * a;
+    q->ab += weight * a * b;
+    q->ac += weight * a * c;
+    q->ad += weight * a * d;
+    q->b2 += weight * b * b;
+    q->bc += weight * b * c;
+    q->bd += weight * b * d;
+    q->c2 += weight * c * c;
+    q->cd += weight * c * d;
+    q->d2 += weight * d * d;
+}
+
+static Quadric quadric_sum(const Quadric* p, const Quadric* q) {
+    return (Quadric){
+        p->a2 + q->a2,
+        p->ab + q->ab,
+        p->ac + q->ac,
+        p->ad + q->ad,
+        p->b2 + q->b2,
+        p->bc + q->bc,
+        p->bd + q->bd,
+        p->c2 + q->c2,
+        p->cd + q->cd,
+        p->d2 + q->d2,
+    };
+}
+
+// Summed squared plane distance of a point
+static double quadric_error(const Quadric* q, Vertex v) {
+    double x = v.x, y = v.y, z = v.z;
+    return q->a2 * x * x + 2 * q->ab * x * y + 2 * q->ac * x * z + 2 * q->ad * x + q->b2 * y * y +
+           2 * q->bc * y * z + 2 * q->bd * y + q->c2 * z * z + 2 * q->cd * z + q->d2;
+}
+
+// Point where the quadric is smallest, from its 3x3 system by Cramer's rule.
+// Returns 0 when the system is close to singular, around flat or straight
+// stretches of the surface.
+static int quadric_optimum(const Quadric* q, Vertex* v) {
+    double det = q->a2 * (q->b2 * q->c2 - q->bc * q->bc) - q->ab * (q->ab * q->c2 - q->bc * q->ac) +
+                 q->ac * (q->ab * q->bc - q->b2 * q->ac);
+    double trace = q->a2 + q->b2 + q->c2;
+    if(fabs(det) <= 1e-10 * trace * trace * trace) return 0;
+
+    double r0 = -q->ad, r1 = -q->bd, r2 = -q->cd;
+    double x = r0 * (q->b2 * q->c2 - q->bc * q->bc) - q->ab * (r1 * q->c2 - q->bc * r2) +
+               q->ac * (r1 * q->bc - q->b2 * r2);
+    double y = q->a2 * (r1 * q->c2 - q->bc * r2) - r0 * (q->ab * q->c2 - q->bc * q->ac) +
+               q->ac * (q->ab * r2 - r1 * q->ac);
+    double z = q->a2 * (q->b2 * r2 - r1 * q->bc) - q->ab * (q->ab * r2 - r1 * q->ac) +
+               r0 * (q->ab * q->bc - q->b2 * q->ac);
+    *v = (Vertex){(float)(x / det), (float)(y / det), (float)(z / det)};
+    return 1;
+}
+
+// Where the edge (a, b) collapses to and the error it adds. The optimum is
+// only trusted near the edge, otherwise the best of the ends and the middle
+// is taken.
+static float collapse_target(int a, int b, Quadric* q, Vertex* p) {
+    *q = quadric_sum(&quadrics[a], &quadrics[b]);
+    Vertex va = vertices[a], vb = vertices[b];
+    Vertex mid = {(va.x + vb.x) / 2, (va.y + vb.y) / 2, (va.z + vb.z) / 2};
+    Vertex d = {vb.x - va.x, vb.y - va.y, vb.z - va.z};
+    float length_sq = d.x * d.x + d.y * d.y + d.z * d.z;
+
+    if(quadric_optimum(q, p)) {
+        Vertex o = {p->x - mid.x, p->y - mid.y, p->z - mid.z};
+        if(o.x * o.x + o.y * o.y + o.z * o.z <= length_sq) {
+            double error = quadric_error(q, *p);
+            return error > 0 ? (float)error : 0;
+        }
+    }
+    Vertex candidates[3] = {va, vb, mid};
+    double best = INFINITY;
+    for(int i = 0; i < 3; i++) {
+        double error = quadric_error(q, candidates[i]);
+        if(error < best) {
+            best = error;
+            *p = candidates[i];
+        }
+    }
+    return best > 0 ? (float)best : 0;
+}
+
+static void heap_push(Collapse entry) {
+    heap = grow(heap, heap_count, &heap_capacity, sizeof(Collapse));
+    int i = heap_count++;
+    while(i > 0) {
+        int parent = (i - 1) / 2;
+        if(heap[parent].cost <= entry.cost) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = entry;
+}
+
+// Move entry down from slot i to where it keeps the heap order
+static void heap_sift_down(int i, Collapse entry) {
+    for(;;) {
+        int child = i * 2 + 1;
+        if(child >= heap_count) break;
+        if(child + 1 < heap_count && heap[child + 1].cost < heap[child].cost) child++;
+        if(entry.cost <= heap[child].cost) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = entry;
+}
+
+static Collapse heap_pop(void) {
+    Collapse top = heap[0];
+    heap_count--;
+    if(heap_count > 0) heap_sift_down(0, heap[heap_count]);
+    return top;
+}
+
+static int collapse_current(const Collapse* entry) {
+    return vertex_version[entry->v1] == entry->version1 && vertex_version[entry->v2] == entry->version2;
+}
+
+// Drop the entries outdated by earlier collapses and restore the heap order
+static void heap_compact(void) {
+    int kept = 0;
+    for(int i = 0; i < heap_count; i++) {
+        if(collapse_current(&heap[i])) heap[kept++] = heap[i];
+    }
+    heap_count = kept;
+    for(int i = heap_count / 2 - 1; i >= 0; i--) heap_sift_down(i, heap[i]);
+}
+
+static Collapse make_collapse(int a, int b) {
+    Quadric q;
+    Vertex p;
+    float cost = collapse_target(a, b, &q, &p);
+    return (Collapse){cost, a, b, vertex_version[a], vertex_version[b]};
+}
+
+// Collect the vertices sharing a live face with v, marked with the returned
+// stamp, and drop the corners of removed faces from v's list on the way
+static int gather_neighbors(int v) {
+    int stamp = ++mark_stamp;
+    neighbor_count = 0;
+    int* link = &vertex_corners[v];
+    while(*link >= 0) {
+        int c = *link;
+        if(face_removed[c / 3]) {
+            *link = corner_next[c];
+            continue;
+        }
+        const Face* f = &faces[c / 3];
+        int corners[3] = {f->v1, f->v2, f->v3};
+        for(int k = 0; k < 3; k++) {
+            int n = corners[k];
+            if(n == v || vertex_mark[n] == stamp) continue;
+            vertex_mark[n] = stamp;
+            neighbors = grow(neighbors, neighbor_count, &neighbor_capacity, sizeof(int));
+            neighbors[neighbor_count++] = n;
+        }
+        link = &corner_next[c];
+    }
+    return stamp;
+}
+
+// More than two shared neighbors would glue two sheets of the mesh together
+// and leave an edge with more than two faces
+static int collapse_pinches(int a, int b) {
+    int stamp = gather_neighbors(a);
+    int common = 0;
+    for(int c = vertex_corners[b]; c >= 0; c = corner_next[c]) {
+        if(face_removed[c / 3]) continue;
+        const Face* f = &faces[c / 3];
+        int corners[3] = {f->v1, f->v2, f->v3};
+        for(int k = 0; k < 3; k++) {
+            if(corners[k] != b && vertex_mark[corners[k]] == stamp) {
+                vertex_mark[corners[k]] = -1;
+                common++;
+            }
+        }
+    }
+    return common > 2;
+}
+
+// Whether a face of v that stays turns over, or nearly, when v moves to p.
+// Faces holding both a and b disappear and are not checked.
+static int collapse_folds(int v, int a, int b, Vertex p) {
+    for(int c = vertex_corners[v]; c >= 0; c = corner_next[c]) {
+        if(face_removed[c / 3]) continue;
+        const Face* f = &faces[c / 3];
+        int has_a = f->v1 == a || f->v2 == a || f->v3 == a;
+        int has_b = f->v1 == b || f->v2 == b || f->v3 == b;
+        if(has_a && has_b) continue;
+
+        Vertex corners[3] = {vertices[f->v1], vertices[f->v2], vertices[f->v3]};
+        Vertex n0 = face_normal(f);
+        corners[c % 3] = p;
+        Vertex u = {corners[1].x - corners[0].x, corners[1].y - corners[0].y, corners[1].z - corners[0].z};
+        Vertex w = {corners[2].x - corners[0].x, corners[2].y - corners[0].y, corners[2].z - corners[0].z};
+        Vertex n1 = {u.y * w.z - u.z * w.y, u.z * w.x - u.x * w.z, u.x * w.y - u.y * w.x};
+        float length = sqrtf(dot(n1, n1));
+        if(length == 0 || dot(n0, n1) < FOLD_MIN_COS * length) return 1;
+    }
+    return 0;
+}
+
+// Merge b into a at p, returns the number of faces removed
+static int collapse_edge(int a, int b, Vertex p, const Quadric* q) {
+    int removed = 0;
+    int tail = -1;
+    vertices[a] = p;
+    quadrics[a] = *q;
+    for(int c = vertex_corners[b]; c >= 0; c = corner_next[c]) {
+        tail = c;
+        int f = c / 3;
+        if(face_removed[f]) continue;
+        if(faces[f].v1 == a || faces[f].v2 == a || faces[f].v3 == a) {
+            face_removed[f] = 1;
+            removed++;
+        } else {
+            *corner_vertex(c) = a;
+        }
+    }
+    if(tail >= 0) {
+        corner_next[tail] = vertex_corners[a];
+        vertex_corners[a] = vertex_corners[b];
+        vertex_corners[b] = -1;
+    }
+    vertex_version[a]++;
+    vertex_version[b]++;
+    return removed;
+}
+
+// Copy the live faces and the vertices they use into a level, keeping the
+// vertex order
+static void save_level(Level* level) {
+    int* new_index = allocate(sizeof(int) * vertex_count);
+    for(int i = 0; i < vertex_count; i++) new_index[i] = -1;
+    level->face_count = 0;
+    for(int f = 0; f < face_count; f++) {
+        if(face_removed[f]) continue;
+        new_index[faces[f].v1] = new_index[faces[f].v2] = new_index[faces[f].v3] = 0;
+        level->face_count++;
+    }
+    level->vertex_count = 0;
+    for(int i = 0; i < vertex_count; i++) {
+        if(new_index[i] == 0) new_index[i] = level->vertex_count++;
+    }
+
+    level->vertices = allocate(sizeof(Vertex) * level->vertex_count);
+    level->faces = allocate(sizeof(Face) * level->face_count);
+    for(int i = 0; i < vertex_count; i++) {
+        if(new_index[i] >= 0) level->vertices[new_index[i]] = vertices[i];
+    }
+    int next = 0;
+    for(int f = 0; f < face_count; f++) {
+        if(face_removed[f]) continue;
+        level->faces[next++] = (Face){new_index[faces[f].v1], new_index[faces[f].v2], new_index[faces[f].v3]};
+    }
+    free(new_index);
+}
+
+// Collapse edges of the parsed mesh until it is down to each of the
+// descending triangle targets in turn and save a level at each. Returns the
+// number of collapses.
+static int decimate(const int* targets, int level_count, Level* levels) {
+    quadrics = calloc(vertex_count, sizeof(Quadric));
+    vertex_version = calloc(vertex_count, sizeof(uint32_t));
+    vertex_mark = calloc(vertex_count, sizeof(int));
+    face_removed = calloc(face_count, 1);
+    vertex_corners = allocate(sizeof(int) * vertex_count);
+    corner_next = allocate(sizeof(int) * face_count * 3);
+    if(!quadrics || !vertex_version || !vertex_mark || !face_removed) {
+        fprintf(stderr, "Error: Out of memory for decimation\n");
+        exit(1);
+    }
+
+    for(int i = 0; i < vertex_count; i++) vertex_corners[i] = -1;
+    for(int c = 0; c < face_count * 3; c++) {
+        int v = *corner_vertex(c);
+        corner_next[c] = vertex_corners[v];
+        vertex_corners[v] = c;
+    }
+
+    // Area-weighted face planes
+    for(int f = 0; f < face_count; f++) {
+        Vertex a = vertices[faces[f].v1], b = vertices[faces[f].v2], c = vertices[faces[f].v3];
+        Vertex u = {b.x - a.x, b.y - a.y, b.z - a.z};
+        Vertex v = {c.x - a.x, c.y - a.y, c.z - a.z};
+        Vertex n = {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+        double length = sqrt(dot(n, n));
+        if(length == 0) continue;
+        double nx = n.x / length, ny = n.y / length, nz = n.z / length;
+        double d = -(nx * a.x + ny * a.y + nz * a.z);
+        int corners[3] = {faces[f].v1, faces[f].v2, faces[f].v3};
+        for(int k = 0; k < 3; k++) {
+            quadric_add_plane(&quadrics[corners[k]], nx, ny, nz, d, length / 2);
+        }
+    }
+
+    // Border planes through each open edge, at right angles to its face
+    build_edges();
+    for(int i = 0; i < edge_count; i++) {
+        const Edge* e = &edges[i];
+        if(e->f2 != NO_FACE) continue;
+        Vertex a = vertices[e->v1], b = vertices[e->v2];
+        Vertex along = {b.x - a.x, b.y - a.y, b.z - a.z};
+        Vertex n = face_normal(&faces[e->f1]);
+        Vertex m = {along.y * n.z - along.z * n.y, along.z * n.x - along.x * n.z, along.x * n.y - along.y * n.x};
+        double length = sqrt(dot(m, m));
+        if(length == 0) continue;
+        double mx = m.x / length, my = m.y / length, mz = m.z / length;
+        double d = -(mx * a.x + my * a.y + mz * a.z);
+        double weight = BORDER_WEIGHT * dot(along, along);
+        quadric_add_plane(&quadrics[e->v1], mx, my, mz, d, weight);
+        quadric_add_plane(&quadrics[e->v2], mx, my, mz, d, weight);
+    }
+    // Heapify all edges at once, cheaper than pushing them one by one
+    heap_capacity = edge_count;
+    heap = allocate(sizeof(Collapse) * heap_capacity);
+    for(int i = 0; i < edge_count; i++) {
+        heap[i] = make_collapse(edges[i].v1, edges[i].v2);
+    }
+    heap_count = edge_count;
+    for(int i = heap_count / 2 - 1; i >= 0; i--) heap_sift_down(i, heap[i]);
+
+    int live_faces = face_count;
+    int collapses = 0;
+    int level = 0;
+    for(;;) {
+        while(level < level_count && live_faces <= targets[level]) {
+            save_level(&levels[level++]);
+        }
+        if(level == level_count) break;
+        if(heap_count == 0) {
+            fprintf(stderr, "Warning: No collapse left below %d triangles\n", live_faces);
+            while(level < level_count) save_level(&levels[level++]);
+            break;
+        }
+
+        // A live mesh has about 1.5 edges per face, the rest of a heap much
+        // larger than that is outdated entries that slow every pop
+        if(heap_count > live_faces * 3 + HEAP_MIN_COMPACT) heap_compact();
+
+        Collapse top = heap_pop();
+        int a = top.v1, b = top.v2;
+        if(!collapse_current(&top)) continue;
+        if(vertex_corners[a] < 0 || vertex_corners[b] < 0) continue;
+
+        Quadric q;
+        Vertex p;
+        collapse_target(a, b, &q, &p);
+        if(collapse_pinches(a, b) || collapse_folds(a, a, b, p) || collapse_folds(b, a, b, p)) continue;
+
+        live_faces -= collapse_edge(a, b, p, &q);
+        collapses++;
+        gather_neighbors(a);
+        for(int i = 0; i < neighbor_count; i++) {
+            heap_push(make_collapse(a, neighbors[i]));
+        }
+    }
+
+    free(quadrics);
+    free(vertex_version);
+    free(vertex_mark);
+    free(face_removed);
+    free(vertex_corners);
+    free(corner_next);
+    free(heap);
+    heap = NULL;
+    heap_count = heap_capacity = 0;
+    return collapses;
+}
+
+// Build an include guard style name (TEAPOT_DECIMATED) from the output path,
+// also the symbol prefix of the generated header
+static void make_guard_name(const char* path, char* guard, size_t size) {
+    const char* base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+
+    strncpy(guard, base, size - 1);
+    guard[size - 1] = '\0';
+
+    char* dot = strrchr(guard, '.');
+    if(dot) *dot = '\0';
+
+    for(char* c = guard; *c; c++) {
+        *c = isalnum((unsigned char)*c) ? (char)toupper((unsigned char)*c) : '_';
+    }
+}
+
+static int is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static const char* skip_blanks(const char* c) {
+    while(is_blank(*c)) c++;
+    return c;
+}
+
+// Parse a decimal number with optional sign, fraction and exponent. Up to 18
+// significant digits are gathered in an integer and scaled once by a power
+// of ten, exact enough for the float the result ends up in. Returns NULL
+// when c does not start with a number.
+static const char* parse_number(const char* c, double* value) {
+    static const double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+    int negative = *c == '-';
+    if(*c == '-' || *c == '+') c++;
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    const char* start = c;
+    for(; *c >= '0' && *c <= '9'; c++) {
+        if(digits < 18) {
+            mantissa = mantissa * 10 + (uint64_t)(*c - '0');
+            if(mantissa) digits++;
+        } else {
+            exponent++;
+        }
+    }
+    if(*c == '.') {
+        for(c++; *c >= '0' && *c <= '9'; c++) {
+            if(digits < 18) {
+                mantissa = mantissa * 10 + (uint64_t)(*c - '0');
+                if(mantissa) digits++;
+                exponent--;
+            }
+        }
+    }
+    if(c == start || (c == start + 1 && *start == '.')) return NULL;
+
+    if(*c == 'e' || *c == 'E') {
+        const char* e = c + 1;
+        int exponent_negative = *e == '-';
+        if(*e == '-' || *e == '+') e++;
+        if(*e >= '0' && *e <= '9') {
+            int n = 0;
+            for(; *e >= '0' && *e <= '9'; e++) {
+                if(n < 10000) n = n * 10 + (*e - '0');
+            }
+            exponent += exponent_negative ? -n : n;
+            c = e;
+        }
+    }
+
+    double v = (double)mantissa;
+    if(exponent < 0) {
+        v = -exponent <= 22 ? v / powers[-exponent] : v / pow(10, -exponent);
+    } else if(exponent > 0) {
+        v = exponent <= 22 ? v * powers[exponent] : v * pow(10, exponent);
+    }
+    *value = negative ? -v : v;
+    return c;
+}
+
+// Parse the vertex index of one face corner and skip its texture and normal
+// indices (v, v/vt, v//vn, v/vt/vn). Returns NULL when there is none.
+static const char* parse_corner(const char* c, long* index) {
+    int negative = *c == '-';
+    if(*c == '-' || *c == '+') c++;
+    if(*c < '0' || *c > '9') return NULL;
+    long n = 0;
+    for(; *c >= '0' && *c <= '9'; c++) {
+        if(n < 0x7FFFFFFF) n = n * 10 + (*c - '0');
+    }
+    *index = negative ? -n : n;
+    while(*c && !is_blank(*c)) c++;
+    return c;
+}
+
+// OBJ indices are 1-based, negative ones count back from the end
+static int resolve_index(long index) {
+    long i = index < 0 ? vertex_count + index : index - 1;
+    return i >= 0 && i < vertex_count ? (int)i : -1;
+}
+
+typedef struct {
+    long line_number;
+    int polygon_count; // Faces with more than three corners, split into fans
+    int degenerate_count;
+    int invalid_count;
+} ParseStats;
+
+static void add_triangle(int a, int b, int c, ParseStats* stats) {
+    // Collapsed triangles have no area and can never face the camera
+    if(a == b || b == c || c == a) {
+        stats->degenerate_count++;
+        return;
+    }
+    faces = grow(faces, face_count, &face_capacity, sizeof(Face));
+    faces[face_count++] = (Face){a, b, c};
+}
+
+// Parse one line without its terminator, only v and f records are used
+static void parse_line(const char* line, ParseStats* stats) {
+    const char* c = skip_blanks(line);
+
+    if(c[0] == 'v' && is_blank(c[1])) {
+        double xyz[3];
+        c += 2;
+        for(int i = 0; i < 3; i++) {
+            c = parse_number(skip_blanks(c), &xyz[i]);
+            if(!c) {
+                fprintf(stderr, "Warning: Skipping vertex on line %ld: %s\n", stats->line_number, line);
+                return;
+            }
+        }
+        vertices = grow(vertices, vertex_count, &vertex_capacity, sizeof(Vertex));
+        vertices[vertex_count++] = (Vertex){(float)xyz[0], (float)xyz[1], (float)xyz[2]};
+    } else if(c[0] == 'f' && is_blank(c[1])) {
+        // Vertex indices of the corners, grows to the largest polygon
+        static int* corners;
+        static int corner_capacity = 0;
+        int corner_count = 0;
+        long index;
+
+        // Resolve every corner first, so a bad one skips the whole polygon
+        c = skip_blanks(c + 2);
+        while(*c && *c != '#') {
+            c = parse_corner(c, &index);
+            int v = c ? resolve_index(index) : -1;
+            if(v < 0) {
+                fprintf(stderr, "Warning: Skipping face with invalid index on line %ld: %s\n", stats->line_number, line);
+                stats->invalid_count++;
+                return;
+            }
+            corners = grow(corners, corner_count, &corner_capacity, sizeof(int));
+            corners[corner_count++] = v;
+            c = skip_blanks(c);
+        }
+        for(int i = 2; i < corner_count; i++) {
+            add_triangle(corners[0], corners[i - 1], corners[i], stats);
+        }
+        if(corner_count > 3) stats->polygon_count++;
+    }
+}
+
+// Stream the OBJ file through a buffer of READ_CHUNK bytes, parsing every
+// complete line in place. A line longer than the buffer grows it.
+static int parse_obj(FILE* in, ParseStats* stats, size_t* bytes) {
+    size_t capacity = READ_CHUNK;
+    char* buffer = allocate(capacity + 1);
+    size_t used = 0;
+    *bytes = 0;
+
+    for(;;) {
+        if(used == capacity) {
+            capacity *= 2;
+            buffer = realloc(buffer, capacity + 1);
+            if(!buffer) {
+                fprintf(stderr, "Error: Out of memory for a %zu byte line\n", capacity);
+                return 0;
+            }
+        }
+        size_t n = fread(buffer + used, 1, capacity - used, in);
+        *bytes += n;
+        int end_of_file = n == 0;
+        used += n;
+        if(end_of_file && used == 0) break;
+        if(end_of_file) buffer[used++] = '\n'; // Last line without a newline
+
+        char* line = buffer;
+        char* buffer_end = buffer + used;
+        for(;;) {
+            char* newline = memchr(line, '\n', (size_t)(buffer_end - line));
+            if(!newline) break;
+            *newline = '\0';
+            stats->line_number++;
+            parse_line(line, stats);
+            line = newline + 1;
+        }
+
+        // Keep the partial last line for the next chunk
+        used = (size_t)(buffer_end - line);
+        memmove(buffer, line, used);
+        if(end_of_file) break;
+    }
+
+    free(buffer);
+    if(ferror(in)) {
+        fprintf(stderr, "Error: Reading the input file failed\n");
+        return 0;
+    }
+    return 1;
+}
+
+static double seconds_now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Unit normal following the winding and offset dot(normal, vertex 1)
+static void face_plane(const Face* f, float plane[4]) {
+    Vertex n = face_normal(f);
+    Vertex v = vertices[f->v1];
+    plane[0] = n.x;
+    plane[1] = n.y;
+    plane[2] = n.z;
+    plane[3] = n.x * v.x + n.y * v.y + n.z * v.z;
+}
+
+// Write the arrays and the TeapotMesh of the current level, symbols
+// prefixed with prefix and the count macros with guard
+static void write_mesh(FILE* out, const char* guard, const char* prefix) {
+    fprintf(out, "#define %s_VERTEX_COUNT %d\n", guard, vertex_count);
+    fprintf(out, "#define %s_TRIANGLE_COUNT %d\n", guard, face_count);
+    fprintf(out, "#define %s_EDGE_COUNT %d\n", guard, edge_count);
+    fprintf(out, "#define %s_CLUSTER_COUNT %d\n\n", guard, cluster_count);
+
+    fprintf(out, "// Unique teapot vertices\n");
+    fprintf(out, "// Each vertex is 3 int16 (x, y, z), model position is\n");
+    fprintf(out, "// vertex * %s_mesh.vertex_scale\n", prefix);
+    fprintf(out, "static const int16_t %s_vertices[] = {\n", prefix);
+    for(int i = 0; i < vertex_count; i++) {
+        fprintf(out, "    %d, %d, %d,\n", quantized[i][0], quantized[i][1], quantized[i][2]);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Teapot triangles as indices into %s_vertices\n", prefix);
+    fprintf(out, "// Each triangle is 3 indices\n");
+    fprintf(out, "static const uint16_t %s_indices[] = {\n", prefix);
+    for(int i = 0; i < face_count; i++) {
+        fprintf(out, "    %d, %d, %d,\n", faces[i].v1, faces[i].v2, faces[i].v3);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Teapot triangle planes, parallel to %s_indices\n", prefix);
+    fprintf(out, "// Each plane is 4 floats (normal x, y, z, offset), the unit normal\n");
+    fprintf(out, "// follows the winding and offset is dot(normal, vertex 1)\n");
+    fprintf(out, "static const float %s_face_planes[] = {\n", prefix);
+    for(int i = 0; i < face_count; i++) {
+        float plane[4];
+        face_plane(&faces[i], plane);
+        fprintf(out, "    %.6ff, %.6ff, %.6ff, %.6ff,\n", plane[0], plane[1], plane[2], plane[3]);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Triangle clusters, each is 2 values (first triangle, triangle count)\n");
+    fprintf(out, "static const uint16_t %s_clusters[] = {\n", prefix);
+    for(int i = 0; i < cluster_count; i++) {
+        fprintf(out, "    %d, %d,\n", clusters[i].first, clusters[i].count);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Cluster bounds, parallel to %s_clusters\n", prefix);
+    fprintf(out, "// Each is 9 floats: bounding sphere center x, y, z and radius, normal\n");
+    fprintf(out, "// cone axis x, y, z, cosine and sine of the cone half-angle\n");
+    fprintf(out, "static const float %s_cluster_bounds[] = {\n", prefix);
+    for(int i = 0; i < cluster_count; i++) {
+        const Cluster* c = &clusters[i];
+        fprintf(
+            out,
+            "    %.6ff, %.6ff, %.6ff, %.6ff, %.6ff, %.6ff, %.6ff, %.6ff, %.6ff,\n",
+            c->center.x,
+            c->center.y,
+            c->center.z,
+            c->radius,
+            c->axis.x,
+            c->axis.y,
+            c->axis.z,
+            c->cone_cos,
+            c->cone_sin);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Unique teapot edges with their adjacent triangles\n");
+    fprintf(out, "// Each edge is 4 indices (vertex 1, vertex 2, face 1, face 2),\n");
+    fprintf(out, "// face 2 is TEAPOT_NO_FACE on open borders\n");
+    fprintf(out, "static const uint16_t %s_edges[] = {\n", prefix);
+    for(int i = 0; i < edge_count; i++) {
+        int f2 = edges[i].f2 == NO_FACE ? HEADER_NO_FACE : edges[i].f2;
+        fprintf(out, "    %d, %d, %d, %d,\n", edges[i].v1, edges[i].v2, edges[i].f1, f2);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Per-edge flags, parallel to %s_edges\n", prefix);
+    fprintf(out, "static const uint8_t %s_edge_flags[] = {\n", prefix);
+    for(int i = 0; i < edge_count; i += 16) {
+        fprintf(out, "   ");
+        for(int j = i; j < edge_count && j < i + 16; j++) {
+            fprintf(out, " %d,", edges[j].flags);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const TeapotMesh %s_mesh = {\n", prefix);
+    fprintf(out, "    .name = \"%s\",\n", prefix);
+    fprintf(out, "    .vertex_count = %s_VERTEX_COUNT,\n", guard);
+    fprintf(out, "    .triangle_count = %s_TRIANGLE_COUNT,\n", guard);
+    fprintf(out, "    .edge_count = %s_EDGE_COUNT,\n", guard);
+    fprintf(out, "    .cluster_count = %s_CLUSTER_COUNT,\n", guard);
+    fprintf(out, "    .vertices = %s_vertices,\n", prefix);
+    fprintf(out, "    .vertex_scale = %.9ef,\n", quantize_scale);
+    fprintf(out, "    .bounds_min = {%.6ff, %.6ff, %.6ff},\n", bounds_min.x, bounds_min.y, bounds_min.z);
+    fprintf(out, "    .bounds_max = {%.6ff, %.6ff, %.6ff},\n", bounds_max.x, bounds_max.y, bounds_max.z);
+    fprintf(out, "    .centroid = {%.6ff, %.6ff, %.6ff},\n", centroid.x, centroid.y, centroid.z);
+    // Rounded up so the printed sphere still holds every vertex
+    fprintf(
+        out,
+        "    .bounding_sphere = {%.6ff, %.6ff, %.6ff, %.6ff},\n",
+        sphere_center.x,
+        sphere_center.y,
+        sphere_center.z,
+        sphere_radius + 2e-6f);
+    fprintf(out, "    .indices = %s_indices,\n", prefix);
+    fprintf(out, "    .face_planes = %s_face_planes,\n", prefix);
+    fprintf(out, "    .clusters = %s_clusters,\n", prefix);
+    fprintf(out, "    .cluster_bounds = %s_cluster_bounds,\n", prefix);
+    fprintf(out, "    .edges = %s_edges,\n", prefix);
+    fprintf(out, "    .edge_flags = %s_edge_flags,\n", prefix);
+    fprintf(out, "};\n\n");
+}
+
+// Append size bytes to the asset at the next TEAPOT_ASSET_ALIGN boundary,
+// returns their offset
+static uint32_t write_section(FILE* out, const void* data, size_t size) {
+    long offset = ftell(out);
+    while(offset % TEAPOT_ASSET_ALIGN) {
+        fputc(0, out);
+        offset++;
+    }
+    fwrite(data, 1, size, out);
+    return (uint32_t)offset;
+}
+
+// Append the arrays of the current level to the asset and fill its record
+static void write_asset_level(FILE* out, TeapotAssetLevel* level, const char* name) {
+    memset(level, 0, sizeof(*level));
+    size_t name_length = strlen(name);
+    if(name_length >= sizeof(level->name)) name_length = sizeof(level->name) - 1;
+    memcpy(level->name, name, name_length);
+    level->vertex_count = (uint16_t)vertex_count;
+    level->triangle_count = (uint16_t)face_count;
+    level->edge_count = (uint16_t)edge_count;
+    level->cluster_count = (uint16_t)cluster_count;
+    level->vertex_scale = quantize_scale;
+    memcpy(level->bounds_min, &bounds_min, sizeof(level->bounds_min));
+    memcpy(level->bounds_max, &bounds_max, sizeof(level->bounds_max));
+    memcpy(level->centroid, &centroid, sizeof(level->centroid));
+    level->bounding_sphere[0] = sphere_center.x;
+    level->bounding_sphere[1] = sphere_center.y;
+    level->bounding_sphere[2] = sphere_center.z;
+    level->bounding_sphere[3] = sphere_radius;
+
+    level->vertices = write_section(out, quantized, sizeof(int16_t) * 3 * vertex_count);
+
+    uint16_t* indices = allocate(sizeof(uint16_t) * 3 * face_count);
+    float* planes = allocate(sizeof(float) * 4 * face_count);
+    for(int i = 0; i < face_count; i++) {
+        indices[i * 3] = (uint16_t)faces[i].v1;
+        indices[i * 3 + 1] = (uint16_t)faces[i].v2;
+        indices[i * 3 + 2] = (uint16_t)faces[i].v3;
+        face_plane(&faces[i], &planes[i * 4]);
+    }
+    level->indices = write_section(out, indices, sizeof(uint16_t) * 3 * face_count);
+    level->face_planes = write_section(out, planes, sizeof(float) * 4 * face_count);
+    free(indices);
+    free(planes);
+
+    uint16_t* ranges = allocate(sizeof(uint16_t) * 2 * cluster_count + 1);
+    float* bounds = allocate(sizeof(float) * 9 * cluster_count + 1);
+    for(int i = 0; i < cluster_count; i++) {
+        const Cluster* c = &clusters[i];
+        ranges[i * 2] = (uint16_t)c->first;
+        ranges[i * 2 + 1] = (uint16_t)c->count;
+        float* b = &bounds[i * 9];
+        b[0] = c->center.x;
+        b[1] = c->center.y;
+        b[2] = c->center.z;
+        b[3] = c->radius;
+        b[4] = c->axis.x;
+        b[5] = c->axis.y;
+        b[6] = c->axis.z;
+        b[7] = c->cone_cos;
+        b[8] = c->cone_sin;
+    }
+    level->clusters = write_section(out, ranges, sizeof(uint16_t) * 2 * cluster_count);
+    level->cluster_bounds = write_section(out, bounds, sizeof(float) * 9 * cluster_count);
+    free(ranges);
+    free(bounds);
+
+    uint16_t* edge_data = allocate(sizeof(uint16_t) * 4 * edge_count + 1);
+    uint8_t* flags = allocate(edge_count + 1);
+    for(int i = 0; i < edge_count; i++) {
+        edge_data[i * 4] = (uint16_t)edges[i].v1;
+        edge_data[i * 4 + 1] = (uint16_t)edges[i].v2;
+        edge_data[i * 4 + 2] = (uint16_t)edges[i].f1;
+        edge_data[i * 4 + 3] = (uint16_t)(edges[i].f2 == NO_FACE ? HEADER_NO_FACE : edges[i].f2);
+        flags[i] = (uint8_t)edges[i].flags;
+    }
+    level->edges = write_section(out, edge_data, sizeof(uint16_t) * 4 * edge_count);
+    level->edge_flags = write_section(out, flags, edge_count);
+    free(edge_data);
+    free(flags);
+}
+
+// Parse a comma-separated list of descending triangle counts
+static int parse_targets(const char* list, int* targets, int max_count) {
+    int count = 0;
+    const char* c = list;
+    for(;;) {
+        char* end;
+        long target = strtol(c, &end, 10);
+        if(end == c || target <= 0 || count == max_count) return 0;
+        if(count > 0 && target >= targets[count - 1]) return 0;
+        targets[count++] = (int)target;
+        if(*end == '\0') return count;
+        if(*end != ',') return 0;
+        c = end + 1;
+    }
+}
+
+static void usage(const char* name) {
+    printf("Usage: %s [-b] [-l TRIANGLES,...] input.obj output [crease_angle_degrees]\n", name);
+    printf("       %s -p [-l TRIANGLES,...] input.obj\n", name);
+    printf("  -b  write a binary mesh asset (teapot_asset.h) instead of a C header\n");
+    printf("  -l  write one level of detail per triangle count, finest first, each\n");
+    printf("      decimated from the one before. A count at or above the input's\n");
+    printf("      keeps it whole, the default is one level with the whole input\n");
+    printf("  -p  only parse (and decimate) the input and report the timing\n");
+}
+
+int main(int argc, char* argv[]) {
+    int parse_only = 0;
+    int binary = 0;
+    int targets[MAX_LEVELS] = {INT32_MAX};
+    int level_count = 1;
+    int arg = 1;
+    for(; arg < argc && argv[arg][0] == '-'; arg++) {
+        if(strcmp(argv[arg], "-p") == 0) {
+            parse_only = 1;
+        } else if(strcmp(argv[arg], "-b") == 0) {
+            binary = 1;
+        } else if(strcmp(argv[arg], "-l") == 0 && arg + 1 < argc) {
+            level_count = parse_targets(argv[++arg], targets, MAX_LEVELS);
+            if(!level_count) {
+                fprintf(stderr, "Error: -l takes up to %d descending triangle counts\n", MAX_LEVELS);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    int positional = argc - arg;
+    if(parse_only ? positional != 1 : positional != 2 && positional != 3) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char* input = argv[arg];
+    const char* output = parse_only ? NULL : argv[arg + 1];
+    float crease_angle = positional == 3 ? (float)atof(argv[arg + 2]) : DEFAULT_CREASE_ANGLE;
+
+    FILE* in = fopen(input, "rb");
+    if(!in) {
+        fprintf(stderr, "Error: Cannot open input file %s\n", input);
+        return 1;
+    }
+
+    ParseStats stats = {0};
+    size_t bytes;
+    double parse_start = seconds_now();
+    int parsed = parse_obj(in, &stats, &bytes);
+    double parse_seconds = seconds_now() - parse_start;
+    fclose(in);
+    if(!parsed) return 1;
+
+    if(vertex_count == 0) {
+        fprintf(stderr, "Error: No vertices in %s\n", input);
+        return 1;
+    }
+    input_center = bounding_box_center();
+
+    Level levels[MAX_LEVELS];
+    int collapses = 0;
+    double decimate_start = seconds_now();
+    if(level_count == 1 && targets[0] >= face_count) {
+        levels[0] = (Level){vertices, vertex_count, faces, face_count};
+    } else {
+        collapses = decimate(targets, level_count, levels);
+        free(vertices);
+        free(faces);
+    }
+    double decimate_seconds = seconds_now() - decimate_start;
+
+    if(parse_only) {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        double megabytes = bytes / 1e6;
+        printf(
+            "Parsed %s: %.1f MB, %ld lines, %d vertices, %d triangles\n",
+            input,
+            megabytes,
+            stats.line_number,
+            vertex_count,
+            face_count);
+        printf(
+            "%.1f ms, %.1f MB/s, %.2f M triangles/s\n",
+            parse_seconds * 1e3,
+            megabytes / parse_seconds,
+            face_count / parse_seconds / 1e6);
+        if(collapses > 0) {
+            printf("Decimated to");
+            for(int i = 0; i < level_count; i++) {
+                printf("%s %d", i ? "," : "", levels[i].face_count);
+            }
+            printf(
+                " triangles with %d collapses in %.1f ms, %.2f M collapses/s\n",
+                collapses,
+                decimate_seconds * 1e3,
+                collapses / decimate_seconds / 1e6);
+        }
+        printf("Peak memory %ld KB\n", usage.ru_maxrss);
+        return 0;
+    }
+
+    for(int i = 0; i < level_count; i++) {
+        if(levels[i].vertex_count > MAX_INDEX) {
+            fprintf(stderr, "Error: %d vertices do not fit in uint16 indices\n", levels[i].vertex_count);
+            return 1;
+        }
+        if(levels[i].face_count >= HEADER_NO_FACE) {
+            fprintf(stderr, "Error: %d faces do not fit in uint16 edge face indices\n", levels[i].face_count);
+            return 1;
+        }
+    }
+
+    FILE* out = fopen(output, binary ? "wb" : "w");
+    if(!out) {
+        fprintf(stderr, "Error: Cannot open output file %s\n", output);
+        return 1;
+    }
+
+    char base_guard[96];
+    make_guard_name(output, base_guard, sizeof(base_guard));
+    char base_prefix[96];
+    for(size_t i = 0; i < sizeof(base_prefix); i++) {
+        base_prefix[i] = (char)tolower((unsigned char)base_guard[i]);
+        if(!base_guard[i]) break;
+    }
+
+    // The asset's header and level records go in front of the arrays once
+    // their offsets are known
+    TeapotAssetLevel records[MAX_LEVELS];
+    if(binary) {
+        fseek(out, (long)(sizeof(TeapotAssetHeader) + sizeof(TeapotAssetLevel) * level_count), SEEK_SET);
+    } else {
+        fprintf(out, "#ifndef %s_H\n", base_guard);
+        fprintf(out, "#define %s_H\n\n", base_guard);
+        fprintf(out, "#include \"teapot_mesh.h\"\n\n");
+        fprintf(out, "// Data derived from %s\n", input);
+        fprintf(
+            out,
+            "// Centered on the bounding box center (%.6f, %.6f, %.6f) of the input\n",
+            input_center.x,
+            input_center.y,
+            input_center.z);
+        fprintf(out, "// Crease edges bend more than %.1f degrees\n", crease_angle);
+        fprintf(out, "// %d level%s of detail with", level_count, level_count > 1 ? "s" : "");
+        for(int i = 0; i < level_count; i++) {
+            fprintf(out, "%s %d", i ? "," : "", levels[i].face_count);
+        }
+        fprintf(out, " triangles%s\n\n", level_count > 1 ? ", finest first, each decimated from the one before" : "");
+    }
+    printf("Conversion complete! Created %s with %d level%s of detail.\n", output, level_count, level_count > 1 ? "s" : "");
+
+    for(int level = 0; level < level_count; level++) {
+        // Level 0 takes the file name, the others add _lod and their number
+        char guard[128];
+        char prefix[128];
+        if(level == 0) {
+            snprintf(guard, sizeof(guard), "%s", base_guard);
+            snprintf(prefix, sizeof(prefix), "%s", base_prefix);
+        } else {
+            snprintf(guard, sizeof(guard), "%s_LOD%d", base_guard, level);
+            snprintf(prefix, sizeof(prefix), "%s_lod%d", base_prefix, level);
+        }
+
+        vertices = levels[level].vertices;
+        vertex_count = levels[level].vertex_count;
+        faces = levels[level].faces;
+        face_count = levels[level].face_count;
+        cluster_count = 0;
+        quantize_vertices();
+        compute_bounds();
+        build_edges();
+        build_clusters();
+        sort_faces_by_cluster();
+        int crease_count = flag_creases(crease_angle);
+
+        if(binary) {
+            write_asset_level(out, &records[level], prefix);
+            float reach = sqrtf(dot(sphere_center, sphere_center)) + sphere_radius;
+            if(reach > TEAPOT_ASSET_MAX_REACH) {
+                printf(
+                    "Warning: %s reaches %.2f from the origin, the app loads models up to %.1f (TEAPOT_ASSET_MAX_REACH).\n",
+                    prefix,
+                    reach,
+                    TEAPOT_ASSET_MAX_REACH);
+            }
+        } else {
+            fprintf(out, "// Level %d\n", level);
+            write_mesh(out, guard, prefix);
+        }
+
+        printf(
+            "%s: %d triangles, %d edges from %d vertices, %d crease edges above %.1f degrees, %d clusters.\n",
+            prefix,
+            face_count,
+            edge_count,
+            vertex_count,
+            crease_count,
+            crease_angle,
+            cluster_count);
+        printf(
+            "%s: bounding sphere at (%.4f, %.4f, %.4f) with radius %.4f.\n",
+            prefix,
+            sphere_center.x,
+            sphere_center.y,
+            sphere_center.z,
+            sphere_radius);
+
+        free(quantized);
+        free(clusters);
+        free(face_cluster);
+        free(face_neighbors);
+        free(face_neighbor_count);
+    }
+
+    if(binary) {
+        long size = ftell(out);
+        TeapotAssetHeader header = {TEAPOT_ASSET_MAGIC, TEAPOT_ASSET_VERSION, (uint16_t)level_count, (uint32_t)size};
+        fseek(out, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, out);
+        fwrite(records, sizeof(TeapotAssetLevel), level_count, out);
+        printf("Asset is %ld bytes.\n", size);
+        if(size > TEAPOT_ASSET_ARENA_SIZE) {
+            printf("Warning: The app only loads assets up to %d bytes (TEAPOT_ASSET_ARENA_SIZE).\n", TEAPOT_ASSET_ARENA_SIZE);
+        }
+    } else {
+        fprintf(out, "// Levels of detail, finest first\n");
+        fprintf(out, "#define %s_LEVEL_COUNT %d\n", base_guard, level_count);
+        fprintf(out, "static const TeapotMesh* const %s_levels[%s_LEVEL_COUNT] = {\n", base_prefix, base_guard);
+        for(int level = 0; level < level_count; level++) {
+            if(level == 0) {
+                fprintf(out, "    &%s_mesh,\n", base_prefix);
+            } else {
+                fprintf(out, "    &%s_lod%d_mesh,\n", base_prefix, level);
+            }
+        }
+        fprintf(out, "};\n\n");
+
+        fprintf(out, "#endif // %s_H\n", base_guard);
+    }
+    if(ferror(out)) {
+        fprintf(stderr, "Error: Writing %s failed\n", output);
+        fclose(out);
+        return 1;
+    }
+    fclose(out);
+
+    if(collapses > 0) {
+        printf("Decimated with %d edge collapses in %.1f ms.\n", collapses, decimate_seconds * 1e3);
+    }
+    if(stats.polygon_count > 0) {
+        printf("Split %d polygons into triangle fans.\n", stats.polygon_count);
+    }
+    if(stats.degenerate_count > 0) {
+        printf("Skipped %d degenerate triangles.\n", stats.degenerate_count);
+    }
+    if(stats.invalid_count > 0) {
+        printf("Skipped %d faces with invalid indices.\n", stats.invalid_count);
+    }
+
+    return 0;
+}
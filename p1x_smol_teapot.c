@@ -1,60 +1,53 @@
 #include <furi.h>
 #include <gui/gui.h>
 #include <input/input.h>
+#include <storage/storage.h>
 #include <stdlib.h>
-#include <math.h>
 #include <furi_hal_resources.h>
 
 /* generated by fbt from .png files in images folder */
 #include <p1x_smol_teapot_icons.h>
 
-/* include triangulated teapot model */
-#include "teapot_decimated.h"
+/* portable renderer core and its render thread */
+#include "teapot_asset.h"
+#include "teapot_engine.h"
+#include "teapot_lod.h"
+#include "teapot_renderer.h"
 
-#define SCREEN_WIDTH 128
-#define SCREEN_HEIGHT 64
-#define PROJECTION_DISTANCE 190
-#define FRAME_DELAY 33
+#define FRAME_DELAY 33 // Auto-rotation frame period in ms
+#define LOD_TARGET_FPS (1000 / FRAME_DELAY) // Render budget of the LOD governor
+#define TEAPOT_ASSET_PATH APP_DATA_PATH("teapot.tpm") // Optional levels on the SD card
 
-// Model bounds to find center
-#define MODEL_MIN_X -3.0f
-#define MODEL_MAX_X 3.0f
-#define MODEL_MIN_Y 0.0f
-#define MODEL_MAX_Y 3.3f
-#define MODEL_MIN_Z -3.0f
-#define MODEL_MAX_Z 3.0f
-
-typedef struct {
-    float x, y, z;
-} Vec3f;
-
-typedef struct {
-    float m[4][4];
-} Matrix4x4;
+// Render thread settings, override with cdefines in application.fam
+#ifndef RENDER_THREAD_STACK_SIZE
+#define RENDER_THREAD_STACK_SIZE 2048
+#endif
+#ifndef RENDER_THREAD_PRIORITY
+#define RENDER_THREAD_PRIORITY FuriThreadPriorityLow // Below input handling
+#endif
 
 // Model state
-static Vec3f rotation = {0};
-static Vec3f last_rotation = {0}; // Track last rotation state
-static Vec3f position = {0, 0, 30};
-static float scale = 2.0f;
-static bool render_complete = false;
-static bool render_needed = true;
-
-// Model center pivot point
-static Vec3f model_center = {
-    (MODEL_MIN_X + MODEL_MAX_X) / 2.0f,
-    (MODEL_MIN_Y + MODEL_MAX_Y) / 2.0f,
-    (MODEL_MIN_Z + MODEL_MAX_Z) / 2.0f
+static TeapotCamera camera = {
+    .rotation = {0, 0, 0},
+    .position = {0, 0, 30},
+    .scale = 2.0f,
 };
+static RenderKey posted_key = {0}; // Last camera, mode and LOD sent to the renderer
+static bool display_needed = true; // Overlay changed, present the frame again
 
-// Render buffer to avoid direct drawing to screen
-typedef struct {
-    uint8_t* buffer;
-    uint16_t width;
-    uint16_t height;
-} RenderBuffer;
+// Render thread draws into the back buffer, the draw callback shows the front
+static TripleBuffer frames = {0};
+static TeapotRenderer* renderer = NULL;
 
-static RenderBuffer render_buffer = {0};
+// Levels read from TEAPOT_ASSET_PATH, they replace the compiled-in ones
+static TeapotAsset asset;
+static uint8_t* asset_arena = NULL;
+
+// Input event stamped when it was queued, for input-to-present latency
+typedef struct {
+    InputEvent input;
+    uint32_t ticks; // profiler_ticks() in the input callback
+} TeapotEvent;
 
 // App state
 typedef struct {
@@ -63,55 +56,87 @@ typedef struct {
     uint32_t polygons_drawn;
     uint32_t frame_count;
     uint32_t last_frame_time;
+    uint32_t busy_ticks; // Main loop time spent awake, this window, main thread only
+    uint32_t render_ticks; // Render thread time, this window
+    uint32_t cpu_load; // Percent of the last window spent busy
     bool auto_rotate;    // Flag to enable auto-rotation
     float auto_rotate_speed;  // Speed of auto-rotation
     uint8_t rotate_axis;     // 0=X, 1=Y, 2=Z
     bool show_title_screen; // Flag to show title screen instead of 3D teapot
+    bool title_key_held; // The key that left the title screen is not released yet
+    InputKey title_key;
+    RenderMode render_mode;
+    LodGovernor governor; // Level of detail for the next frame, fed by the render thread
+    uint8_t frame_lod; // Level of the newest frame, finer than the governor's once refined
+    bool show_profile; // Show the per-stage timings page instead of the model
+    FrameProfile profile; // Stage timings of the current one-second window
+    FrameProfile profile_shown; // Last complete window, drawn and logged
+    uint32_t present_input_ticks; // Oldest input in the frame being presented
+    bool present_input_pending; // Draw callback still has to time that input
+    ViewPort* view_port;
 } TeapotState;
 
-// Function prototypes
-static void render_complete_model(TeapotState* state);
-static void init_identity_matrix(Matrix4x4* m);
-static void rotate_x_matrix(Matrix4x4* m, float angle);
-static void rotate_y_matrix(Matrix4x4* m, float angle);
-static void rotate_z_matrix(Matrix4x4* m, float angle);
-static void multiply_matrix_vector(Matrix4x4* m, Vec3f* in, Vec3f* out);
-static float dot_product(Vec3f* v1, Vec3f* v2);
-static void cross_product(Vec3f* v1, Vec3f* v2, Vec3f* result);
-static void subtract_vectors(Vec3f* v1, Vec3f* v2, Vec3f* result);
+// Input callback function
+static void input_callback(InputEvent* input_event, void* ctx) {
+    furi_assert(ctx);
+    FuriMessageQueue* event_queue = ctx;
+    TeapotEvent event = {.input = *input_event, .ticks = profiler_ticks()};
+    furi_message_queue_put(event_queue, &event, FuriWaitForever);
+}
 
-// Draw pixel to our buffer
-static void buffer_draw_pixel(uint8_t x, uint8_t y) {
-    if(x < render_buffer.width && y < render_buffer.height) {
-        uint16_t byte_idx = y * (render_buffer.width / 8) + (x / 8);
-        uint8_t bit_pos = x % 8;
-        render_buffer.buffer[byte_idx] |= (1 << bit_pos);
-    }
+// One min/avg/max row of the profiler page, in microseconds
+static void draw_profile_row(Canvas* canvas, int y, const char* name, const ProfileStageStats* stats) {
+    uint32_t ticks_per_us = profiler_ticks_per_us();
+    char text[12];
+    
+    canvas_draw_str(canvas, 2, y, name);
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(stats->min / ticks_per_us));
+    canvas_draw_str_aligned(canvas, 62, y, AlignRight, AlignBottom, text);
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(frame_profile_avg(stats) / ticks_per_us));
+    canvas_draw_str_aligned(canvas, 94, y, AlignRight, AlignBottom, text);
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(stats->max / ticks_per_us));
+    canvas_draw_str_aligned(canvas, 126, y, AlignRight, AlignBottom, text);
 }
 
-// Draw line to our buffer (Bresenham's line algorithm)
-static void buffer_draw_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
-    int dx = abs(x1 - x0);
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = -abs(y1 - y0);
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-    int e2;
-    
-    while (true) {
-        buffer_draw_pixel(x0, y0);
-        if (x0 == x1 && y0 == y1) break;
-        e2 = 2 * err;
-        if (e2 >= dy) { if (x0 == x1) break; err += dy; x0 += sx; }
-        if (e2 <= dx) { if (y0 == y1) break; err += dx; y0 += sy; }
+// Per-stage frame times and input-to-present latency of the last window
+static void draw_profile_page(Canvas* canvas, TeapotState* state) {
+    char text[12];
+    
+    canvas_set_color(canvas, ColorWhite);
+    canvas_draw_box(canvas, 0, 0, 128, 64);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+    snprintf(text, sizeof(text), "CPU %lu%%", (unsigned long)state->cpu_load);
+    canvas_draw_str(canvas, 2, 7, text);
+    canvas_draw_str_aligned(canvas, 62, 7, AlignRight, AlignBottom, "min");
+    canvas_draw_str_aligned(canvas, 94, 7, AlignRight, AlignBottom, "avg");
+    canvas_draw_str_aligned(canvas, 126, 7, AlignRight, AlignBottom, "max");
+    
+    for(int i = 0; i < ProfileStageCount; i++) {
+        draw_profile_row(canvas, 15 + i * 8, profile_stage_names[i], &state->profile_shown.stages[i]);
     }
+    draw_profile_row(canvas, 15 + ProfileStageCount * 8, "input", &state->profile_shown.input_latency);
 }
 
-// Input callback function
-static void input_callback(InputEvent* input_event, void* ctx) {
-    furi_assert(ctx);
-    FuriMessageQueue* event_queue = ctx;
-    furi_message_queue_put(event_queue, input_event, FuriWaitForever);
+// Log one min/avg/max line of the profiler window
+static void log_profile_stats(const char* name, const ProfileStageStats* stats) {
+    uint32_t ticks_per_us = profiler_ticks_per_us();
+    FURI_LOG_I(
+        "P1X_SMOL_TEAPOT",
+        "%s us min/avg/max: %lu/%lu/%lu",
+        name,
+        (unsigned long)(stats->min / ticks_per_us),
+        (unsigned long)(frame_profile_avg(stats) / ticks_per_us),
+        (unsigned long)(stats->max / ticks_per_us));
+}
+
+// Log the last complete profiler window
+static void log_profile(const FrameProfile* profile, uint32_t cpu_load) {
+    FURI_LOG_I("P1X_SMOL_TEAPOT", "CPU load: %lu%%", (unsigned long)cpu_load);
+    for(int i = 0; i < ProfileStageCount; i++) {
+        log_profile_stats(profile_stage_names[i], &profile->stages[i]);
+    }
+    log_profile_stats("input", &profile->input_latency);
 }
 
 // Draw callback function - copy our buffer to screen
@@ -119,21 +144,42 @@ static void render_callback(Canvas* canvas, void* ctx) {
     furi_assert(ctx);
     TeapotState* state = ctx;
     
-    if(furi_mutex_acquire(state->mutex, 100) != FuriStatusOk) return;
-    
-    // Only render to screen if we have a buffer ready
-    if(render_buffer.buffer != NULL) {
+    // The newest complete frame, the renderer never writes to it, so no
+    // lock is needed for the blit
+    RenderBuffer* front = triple_buffer_front(&frames);
+    uint32_t blit_ticks = 0;
+    if(front->buffer != NULL) {
+        // Times the copy into the canvas, the display transfer happens
+        // after this callback returns
+        uint32_t blit_start = profiler_ticks();
         canvas_draw_xbm(
             canvas, 
             0, 
             0, 
-            render_buffer.width, 
-            render_buffer.height, 
-            render_buffer.buffer);
+            front->width, 
+            front->height, 
+            front->buffer);
+        blit_ticks = profiler_ticks() - blit_start;
+    }
+    
+    if(furi_mutex_acquire(state->mutex, 100) != FuriStatusOk) return;
+    
+    if(front->buffer != NULL) {
+        if(!state->show_title_screen) {
+            frame_profile_add(&state->profile, ProfileStageBlit, blit_ticks);
+        }
+        
+        // Input-to-present latency, from the input callback to this draw
+        if(state->present_input_pending) {
+            profile_stats_add(&state->profile.input_latency, profiler_ticks() - state->present_input_ticks);
+            state->present_input_pending = false;
+        }
     }
     
     // Only show stats and controls when not on title screen
-    if(!state->show_title_screen) {
+    if(!state->show_title_screen && state->show_profile) {
+        draw_profile_page(canvas, state);
+    } else if(!state->show_title_screen) {
         // Always display the controls text
         canvas_set_color(canvas, ColorBlack);
         if(state->auto_rotate) {
@@ -148,11 +194,17 @@ static void render_callback(Canvas* canvas, void* ctx) {
         // Display FPS and polygon count in the corner
         char stats_text[24];
         snprintf(stats_text, sizeof(stats_text), "FPS:%lu  POLY:%lu", state->fps, state->polygons_drawn);
+        char lod_text[8];
+        snprintf(lod_text, sizeof(lod_text), "L%u", state->frame_lod);
         canvas_set_color(canvas, ColorWhite);
         canvas_draw_box(canvas, 1, 1, 80, 10);  // Background for better visibility
+        canvas_draw_box(canvas, 92, 1, 12, 10);
+        canvas_draw_box(canvas, 105, 1, 22, 10);
         canvas_set_color(canvas, ColorBlack);
         canvas_set_font(canvas, FontSecondary);
         canvas_draw_str(canvas, 2, 9, stats_text);
+        canvas_draw_str_aligned(canvas, 103, 9, AlignRight, AlignBottom, lod_text);
+        canvas_draw_str_aligned(canvas, 126, 9, AlignRight, AlignBottom, render_mode_names[state->render_mode]);
     } else {
         canvas_draw_icon(canvas, 0, 0, &I_title);
         // If we're showing title screen, display actual text on top of our buffer drawing
@@ -171,281 +223,230 @@ static void render_callback(Canvas* canvas, void* ctx) {
     furi_mutex_release(state->mutex);
 }
 
-// Create and initialize render buffer
-static void init_render_buffer() {
-    render_buffer.width = SCREEN_WIDTH;
-    render_buffer.height = SCREEN_HEIGHT;
-    size_t buffer_size = (render_buffer.width / 8) * render_buffer.height;
-    render_buffer.buffer = malloc(buffer_size);
-    if(render_buffer.buffer) {
-        memset(render_buffer.buffer, 0, buffer_size);
-    }
-}
-
-// Clear render buffer
-static void clear_render_buffer() {
-    if(render_buffer.buffer) {
-        size_t buffer_size = (render_buffer.width / 8) * render_buffer.height;
-        memset(render_buffer.buffer, 0, buffer_size);
-    }
-}
-
-// Free render buffer
-static void free_render_buffer() {
-    if(render_buffer.buffer) {
-        free(render_buffer.buffer);
-        render_buffer.buffer = NULL;
-    }
-}
-
-// Simple 3D math functions
-static void init_identity_matrix(Matrix4x4* m) {
-    for(int i = 0; i < 4; i++) {
-        for(int j = 0; j < 4; j++) {
-            m->m[i][j] = (i == j) ? 1.0f : 0.0f;
-        }
-    }
-}
-
-static void rotate_x_matrix(Matrix4x4* m, float angle) {
-    m->m[1][1] = cosf(angle);
-    m->m[1][2] = -sinf(angle);
-    m->m[2][1] = sinf(angle);
-    m->m[2][2] = cosf(angle);
-}
-
-static void rotate_y_matrix(Matrix4x4* m, float angle) {
-    m->m[0][0] = cosf(angle);
-    m->m[0][2] = sinf(angle);
-    m->m[2][0] = -sinf(angle);
-    m->m[2][2] = cosf(angle);
-}
-
-static void rotate_z_matrix(Matrix4x4* m, float angle) {
-    m->m[0][0] = cosf(angle);
-    m->m[0][1] = -sinf(angle);
-    m->m[1][0] = sinf(angle);
-    m->m[1][1] = cosf(angle);
-}
-
-static void multiply_matrix_vector(Matrix4x4* m, Vec3f* in, Vec3f* out) {
-    out->x = in->x * m->m[0][0] + in->y * m->m[1][0] + in->z * m->m[2][0] + m->m[3][0];
-    out->y = in->x * m->m[0][1] + in->y * m->m[1][1] + in->z * m->m[2][1] + m->m[3][1];
-    out->z = in->x * m->m[0][2] + in->y * m->m[1][2] + in->z * m->m[2][2] + m->m[3][2];
-    float w = in->x * m->m[0][3] + in->y * m->m[1][3] + in->z * m->m[2][3] + m->m[3][3];
-    
-    if(w != 0.0f) {
-        out->x /= w;
-        out->y /= w;
-        out->z /= w;
-    }
-}
-
-static float dot_product(Vec3f* v1, Vec3f* v2) {
-    return v1->x * v2->x + v1->y * v2->y + v1->z * v2->z;
-}
-
-static void cross_product(Vec3f* v1, Vec3f* v2, Vec3f* result) {
-    result->x = v1->y * v2->z - v1->z * v2->y;
-    result->y = v1->z * v2->x - v1->x * v2->z;
-    result->z = v1->x * v2->y - v1->y * v2->x;
-}
-
-static void subtract_vectors(Vec3f* v1, Vec3f* v2, Vec3f* result) {
-    result->x = v1->x - v2->x;
-    result->y = v1->y - v2->y;
-    result->z = v1->z - v2->z;
-}
-
 // Render title screen to buffer
 static void render_title_screen() {
+    RenderBuffer* rb = triple_buffer_back(&frames);
+    
     // Clear buffer before rendering
-    clear_render_buffer();
+    render_buffer_clear(rb);
     
     // Draw a teapot shape as a border (simplified outline)
     // Top of teapot
-    buffer_draw_line(30, 15, 98, 15); 
-    buffer_draw_line(30, 15, 25, 25);
-    buffer_draw_line(98, 15, 103, 25);
+    buffer_draw_line(rb, 30, 15, 98, 15); 
+    buffer_draw_line(rb, 30, 15, 25, 25);
+    buffer_draw_line(rb, 98, 15, 103, 25);
     
     // Teapot body outline
-    buffer_draw_line(25, 25, 20, 40);
-    buffer_draw_line(103, 25, 108, 40);
-    buffer_draw_line(20, 40, 108, 40);
+    buffer_draw_line(rb, 25, 25, 20, 40);
+    buffer_draw_line(rb, 103, 25, 108, 40);
+    buffer_draw_line(rb, 20, 40, 108, 40);
     
     // Spout
-    buffer_draw_line(20, 30, 10, 35);
-    buffer_draw_line(10, 35, 20, 40);
+    buffer_draw_line(rb, 20, 30, 10, 35);
+    buffer_draw_line(rb, 10, 35, 20, 40);
     
     // Handle
-    buffer_draw_line(108, 30, 118, 32);
-    buffer_draw_line(118, 32, 108, 40);
+    buffer_draw_line(rb, 108, 30, 118, 32);
+    buffer_draw_line(rb, 118, 32, 108, 40);
     
     // Draw "UTAH TEAPOT" text at top center
     // (We can't draw text directly to the buffer, we'll use lines to create some basic text)
     // U
-    buffer_draw_line(36, 22, 36, 30);
-    buffer_draw_line(36, 30, 44, 30);
-    buffer_draw_line(44, 30, 44, 22);
+    buffer_draw_line(rb, 36, 22, 36, 30);
+    buffer_draw_line(rb, 36, 30, 44, 30);
+    buffer_draw_line(rb, 44, 30, 44, 22);
     
     // T
-    buffer_draw_line(48, 22, 56, 22);
-    buffer_draw_line(52, 22, 52, 30);
+    buffer_draw_line(rb, 48, 22, 56, 22);
+    buffer_draw_line(rb, 52, 22, 52, 30);
     
     // A
-    buffer_draw_line(58, 30, 61, 22);
-    buffer_draw_line(61, 22, 64, 30);
-    buffer_draw_line(59, 26, 63, 26);
+    buffer_draw_line(rb, 58, 30, 61, 22);
+    buffer_draw_line(rb, 61, 22, 64, 30);
+    buffer_draw_line(rb, 59, 26, 63, 26);
     
     // H
-    buffer_draw_line(66, 22, 66, 30);
-    buffer_draw_line(66, 26, 72, 26);
-    buffer_draw_line(72, 22, 72, 30);
+    buffer_draw_line(rb, 66, 22, 66, 30);
+    buffer_draw_line(rb, 66, 26, 72, 26);
+    buffer_draw_line(rb, 72, 22, 72, 30);
     
     // Draw "Press any button" at bottom
     // Draw a box with text inside
-    buffer_draw_line(25, 48, 103, 48);
-    buffer_draw_line(25, 48, 25, 56);
-    buffer_draw_line(25, 56, 103, 56);
-    buffer_draw_line(103, 48, 103, 56);
+    buffer_draw_line(rb, 25, 48, 103, 48);
+    buffer_draw_line(rb, 25, 48, 25, 56);
+    buffer_draw_line(rb, 25, 56, 103, 56);
+    buffer_draw_line(rb, 103, 48, 103, 56);
     
     // Use some simple lines to indicate text inside (can't draw actual text to buffer)
-    buffer_draw_line(35, 52, 95, 52);
-    buffer_draw_line(40, 52, 40, 54);
-    buffer_draw_line(90, 52, 90, 54);
-    buffer_draw_line(35, 54, 95, 54);
+    buffer_draw_line(rb, 35, 52, 95, 52);
+    buffer_draw_line(rb, 40, 52, 40, 54);
+    buffer_draw_line(rb, 90, 52, 90, 54);
+    buffer_draw_line(rb, 35, 54, 95, 54);
+    
+    triple_buffer_publish(&frames);
 }
 
-static void render_complete_model(TeapotState* state) {
-    // Clear buffer before new render
-    clear_render_buffer();
-    
-    // Reset polygon count
-    state->polygons_drawn = 0;
-    
-    // Create rotation matrices
-    Matrix4x4 rot_x_matrix, rot_y_matrix, rot_z_matrix;
-    
-    init_identity_matrix(&rot_x_matrix);
-    init_identity_matrix(&rot_y_matrix);
-    init_identity_matrix(&rot_z_matrix);
-    
-    rotate_x_matrix(&rot_x_matrix, rotation.x);
-    rotate_y_matrix(&rot_y_matrix, rotation.y);
-    rotate_z_matrix(&rot_z_matrix, rotation.z);
-    
-    // Process all triangles
-    for(int i = 0; i < TEAPOT_TRIANGLE_COUNT; i++) {
-        // Extract the triangle vertices from the array
-        Vec3f v1 = {
-            teapot_triangles[i * 9 + 0],
-            teapot_triangles[i * 9 + 1],
-            teapot_triangles[i * 9 + 2]
-        };
-        
-        Vec3f v2 = {
-            teapot_triangles[i * 9 + 3],
-            teapot_triangles[i * 9 + 4],
-            teapot_triangles[i * 9 + 5]
-        };
-        
-        Vec3f v3 = {
-            teapot_triangles[i * 9 + 6],
-            teapot_triangles[i * 9 + 7],
-            teapot_triangles[i * 9 + 8]
-        };
-        
-        // Center each vertex around the model's center point before rotation
-        v1.x -= model_center.x;
-        v1.y -= model_center.y;
-        v1.z -= model_center.z;
-        
-        v2.x -= model_center.x;
-        v2.y -= model_center.y;
-        v2.z -= model_center.z;
-        
-        v3.x -= model_center.x;
-        v3.y -= model_center.y;
-        v3.z -= model_center.z;
-        
-        // Transform vertices
-        Vec3f tv1, tv2, tv3;
-        Vec3f temp1, temp2;
-        
-        // Apply rotation matrices to v1 - Note: order is important for proper 3D perspective!
-        // X and Y rotations first, then Z rotation
-        multiply_matrix_vector(&rot_x_matrix, &v1, &temp1);
-        multiply_matrix_vector(&rot_y_matrix, &temp1, &temp2);
-        multiply_matrix_vector(&rot_z_matrix, &temp2, &temp1);
-        tv1.x = temp1.x * scale + position.x;
-        tv1.y = temp1.y * scale + position.y;
-        tv1.z = temp1.z * scale + position.z;
-        
-        // Apply rotation matrices to v2
-        multiply_matrix_vector(&rot_x_matrix, &v2, &temp1);
-        multiply_matrix_vector(&rot_y_matrix, &temp1, &temp2);
-        multiply_matrix_vector(&rot_z_matrix, &temp2, &temp1);
-        tv2.x = temp1.x * scale + position.x;
-        tv2.y = temp1.y * scale + position.y;
-        tv2.z = temp1.z * scale + position.z;
-        
-        // Apply rotation matrices to v3
-        multiply_matrix_vector(&rot_x_matrix, &v3, &temp1);
-        multiply_matrix_vector(&rot_y_matrix, &temp1, &temp2);
-        multiply_matrix_vector(&rot_z_matrix, &temp2, &temp1);
-        tv3.x = temp1.x * scale + position.x;
-        tv3.y = temp1.y * scale + position.y;
-        tv3.z = temp1.z * scale + position.z;
-        
-        // Skip triangles with vertices too close to camera
-        if(tv1.z < 1.0f || tv2.z < 1.0f || tv3.z < 1.0f) {
-            continue;
+// Runs on the render thread after each new frame was published
+static void frame_rendered(const RenderRequest* request, const RenderStats* stats, void* context) {
+    TeapotState* state = context;
+    
+    if(furi_mutex_acquire(state->mutex, FuriWaitForever) == FuriStatusOk) {
+        state->polygons_drawn = stats->polygons_drawn;
+        state->frame_lod = request->lod;
+        state->frame_count++;
+        uint32_t frame_ticks = 0;
+        for(int i = 0; i < ProfileStageBlit; i++) {
+            frame_profile_add(&state->profile, i, stats->stage_ticks[i]);
+            frame_ticks += stats->stage_ticks[i];
         }
+        state->render_ticks += frame_ticks;
         
-        // Calculate normal using cross product for backface culling
-        Vec3f line1, line2, normal;
-        subtract_vectors(&tv2, &tv1, &line1);
-        subtract_vectors(&tv3, &tv1, &line2);
-        cross_product(&line1, &line2, &normal);
-        
-        // Calculate dot product with camera direction (towards negative z)
-        Vec3f camera_dir = {0, 0, 1};
-        float dot = dot_product(&normal, &camera_dir);
+        // Pick the level of the next frame from this frame's render time,
+        // frames posted before the last switch and refined frames say nothing
+        // about the governor's level
+        if(request->lod == state->governor.lod) {
+            lod_governor_update(&state->governor, frame_ticks);
+        }
         
-        // Only render if facing camera (backface culling)
-        if(dot < 0) {
-            // Project the vertices to screen space
-            int x1 = (int)((tv1.x * PROJECTION_DISTANCE) / tv1.z) + SCREEN_WIDTH/2;
-            int y1 = (int)((-tv1.y * PROJECTION_DISTANCE) / tv1.z) + SCREEN_HEIGHT/2;
-            int x2 = (int)((tv2.x * PROJECTION_DISTANCE) / tv2.z) + SCREEN_WIDTH/2;
-            int y2 = (int)((-tv2.y * PROJECTION_DISTANCE) / tv2.z) + SCREEN_HEIGHT/2;
-            int x3 = (int)((tv3.x * PROJECTION_DISTANCE) / tv3.z) + SCREEN_WIDTH/2;
-            int y3 = (int)((-tv3.y * PROJECTION_DISTANCE) / tv3.z) + SCREEN_HEIGHT/2;
+        // The draw callback times this input when it shows the frame
+        if(request->from_input) {
+            state->present_input_ticks = request->input_ticks;
+            state->present_input_pending = true;
+        }
+        furi_mutex_release(state->mutex);
+    }
+    
+    view_port_update(state->view_port);
+}
+
+// Send the camera to the render thread if it, the mode or the governor's
+// level of detail changed since the last post
+static void post_camera(TeapotState* state, bool from_input, uint32_t input_ticks) {
+    uint8_t lod = posted_key.lod;
+    if(furi_mutex_acquire(state->mutex, 100) == FuriStatusOk) {
+        lod = state->governor.lod;
+        furi_mutex_release(state->mutex);
+    }
+    if(!render_key_changed(&posted_key, &camera, state->render_mode, lod)) return;
+    
+    RenderRequest request = {
+        .camera = camera,
+        .mode = state->render_mode,
+        .lod = lod,
+        .from_input = from_input,
+        .input_ticks = input_ticks,
+    };
+    teapot_renderer_post(renderer, &request);
+    render_key_set(&posted_key, &camera, state->render_mode, lod);
+}
+
+// Apply one input event to the camera and app state, returns false on exit
+static bool process_input(TeapotState* state, InputEvent* event) {
+    bool running = true;
+    
+    // Check if we're in title screen mode
+    if(state->show_title_screen) {
+        // Any button press exits title screen and starts the teapot renderer
+        if(event->type == InputTypePress) {
+            state->show_title_screen = false;
+            state->title_key_held = true;
+            state->title_key = event->key;
+            FURI_LOG_I("P1X_SMOL_TEAPOT", "Exiting title screen");
             
-            // Check if any part of triangle is on screen
-            if((x1 < 0 && x2 < 0 && x3 < 0) || 
-               (x1 >= SCREEN_WIDTH && x2 >= SCREEN_WIDTH && x3 >= SCREEN_WIDTH) ||
-               (y1 < 0 && y2 < 0 && y3 < 0) || 
-               (y1 >= SCREEN_HEIGHT && y2 >= SCREEN_HEIGHT && y3 >= SCREEN_HEIGHT)) {
-                continue;
+            // Start from the initial rotation, the main loop posts the
+            // first frame to the render thread
+            camera.rotation.x = 0;
+            camera.rotation.y = 0;
+            camera.rotation.z = 0;
+        }
+    } else if(state->title_key_held && event->key == state->title_key) {
+        // The rest of the press that left the title screen: its repeats,
+        // short or long event must not also rotate, switch modes or quit
+        if(event->type == InputTypeRelease) state->title_key_held = false;
+    } else {
+        // Process key presses and long presses for the teapot scene
+        if(event->type == InputTypePress || event->type == InputTypeRepeat) {
+            switch(event->key) {
+                case InputKeyUp:
+                    camera.rotation.x += 0.25f;
+                    break;
+                case InputKeyDown:
+                    camera.rotation.x -= 0.25f;
+                    break;
+                case InputKeyLeft:
+                    camera.rotation.y -= 0.25f;
+                    break;
+                case InputKeyRight:
+                    camera.rotation.y += 0.25f;
+                    break;
+                case InputKeyOk:
+                    if(state->auto_rotate) {
+                        // In auto-rotate mode, OK cycles through rotation axes
+                        state->rotate_axis = (state->rotate_axis + 1) % 3; // Cycle through 0,1,2
+                        FURI_LOG_I("P1X_SMOL_TEAPOT", "Auto-rotation axis: %c", 'X' + state->rotate_axis);
+                        display_needed = true;
+                    } else {
+                        // Normal mode - reset rotation
+                        camera.rotation.x = 0;
+                        camera.rotation.y = 0;
+                        camera.rotation.z = 0;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        } else if(event->type == InputTypeShort) {
+            // Exit on release so a long press can switch render modes
+            if(event->key == InputKeyBack) {
+                running = false;
+            }
+        } else if(event->type == InputTypeLong) {
+            // Long press handling
+            switch(event->key) {
+                case InputKeyOk:
+                    // Toggle auto-rotation mode
+                    state->auto_rotate = !state->auto_rotate;
+                    FURI_LOG_I("P1X_SMOL_TEAPOT", "Auto-rotation: %s", state->auto_rotate ? "ON" : "OFF");
+                    display_needed = true;
+                    break;
+                case InputKeyUp:
+                    // Toggle the profiler page
+                    state->show_profile = !state->show_profile;
+                    FURI_LOG_I("P1X_SMOL_TEAPOT", "Profiler: %s", state->show_profile ? "ON" : "OFF");
+                    display_needed = true;
+                    break;
+                case InputKeyBack:
+                    // Cycle through render modes
+                    state->render_mode = (state->render_mode + 1) % RenderModeCount;
+                    FURI_LOG_I("P1X_SMOL_TEAPOT", "Render mode: %s", render_mode_names[state->render_mode]);
+                    break;
+                default:
+                    break;
             }
-            
-            // Draw wireframe triangle to our buffer
-            buffer_draw_line(x1, y1, x2, y2);
-            buffer_draw_line(x2, y2, x3, y3);
-            buffer_draw_line(x3, y3, x1, y1);
-            
-            // Increment polygon count
-            state->polygons_drawn++;
         }
     }
     
-    // Signal that render is complete
-    render_complete = true;
-    render_needed = false;
-    
-    // Remember last rotation state
-    last_rotation = rotation;
+    return running;
+}
+
+// Render the levels of TEAPOT_ASSET_PATH when the SD card has the file. The
+// arena is only allocated then, as malloc does not return on failure.
+static void load_asset(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool present = storage_file_exists(storage, TEAPOT_ASSET_PATH);
+    furi_record_close(RECORD_STORAGE);
+    if(!present) return;
+
+    asset_arena = malloc(TEAPOT_ASSET_ARENA_SIZE);
+    if(teapot_asset_load(&asset, TEAPOT_ASSET_PATH, asset_arena, TEAPOT_ASSET_ARENA_SIZE)) {
+        teapot_lods_use(asset.levels, asset.level_count);
+        FURI_LOG_I("P1X_SMOL_TEAPOT", "Loaded %u levels from %s", asset.level_count, TEAPOT_ASSET_PATH);
+    } else {
+        FURI_LOG_W(
+            "P1X_SMOL_TEAPOT", "Ignoring %s, damaged or over %d bytes", TEAPOT_ASSET_PATH, TEAPOT_ASSET_ARENA_SIZE);
+        free(asset_arena);
+        asset_arena = NULL;
+    }
 }
 
 int32_t p1x_smol_teapot_app(void* p) {
@@ -453,7 +454,7 @@ int32_t p1x_smol_teapot_app(void* p) {
     FURI_LOG_I("P1X_SMOL_TEAPOT", "3D Teapot renderer starting");
     
     // Create event queue
-    FuriMessageQueue* event_queue = furi_message_queue_alloc(8, sizeof(InputEvent));
+    FuriMessageQueue* event_queue = furi_message_queue_alloc(8, sizeof(TeapotEvent));
     
     // Set up state
     TeapotState* state = malloc(sizeof(TeapotState));
@@ -462,14 +463,39 @@ int32_t p1x_smol_teapot_app(void* p) {
     state->polygons_drawn = 0;
     state->frame_count = 0;
     state->last_frame_time = furi_get_tick();
+    state->busy_ticks = 0;
+    state->render_ticks = 0;
+    state->cpu_load = 0;
     state->auto_rotate = false;
     state->auto_rotate_speed = 0.05f;  // Auto-rotation speed
     state->rotate_axis = 0;  // Start with X axis rotation
     state->show_title_screen = true;  // Start with title screen
-    
-    // Initialize render buffer
-    init_render_buffer();
-    
+    state->title_key_held = false;
+    state->render_mode = RenderModeWireframe;
+    // Before anything sizes itself to the levels
+    load_asset();
+    lod_governor_init(&state->governor, LOD_TARGET_FPS);
+    state->frame_lod = state->governor.lod;
+    state->show_profile = false;
+    state->present_input_pending = false;
+    frame_profile_reset(&state->profile);
+    frame_profile_reset(&state->profile_shown);
+    
+    // Initialize render buffer and renderer caches, both free what part of
+    // a failed init allocated
+    if(!triple_buffer_init(&frames, SCREEN_WIDTH, SCREEN_HEIGHT) ||
+       !teapot_engine_init(SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        FURI_LOG_E("P1X_SMOL_TEAPOT", "Out of memory for the frame buffers and render caches");
+        teapot_engine_free();
+        triple_buffer_free(&frames);
+        free(asset_arena);
+        asset_arena = NULL;
+        furi_mutex_free(state->mutex);
+        free(state);
+        furi_message_queue_free(event_queue);
+        return -1;
+    }
+
     // Set up viewport
     ViewPort* view_port = view_port_alloc();
     view_port_draw_callback_set(view_port, render_callback, state);
@@ -482,182 +508,136 @@ int32_t p1x_smol_teapot_app(void* p) {
     Gui* gui = furi_record_open(RECORD_GUI);
     gui_add_view_port(gui, view_port, GuiLayerFullscreen);
     
-    // Initialize values
-    render_needed = true;
-    render_complete = false;
+    state->view_port = view_port;
     
-    // Render the title screen first
+    // Render the title screen first, before the render thread owns the
+    // back buffer
     render_title_screen();
     view_port_update(view_port);
+    
+    renderer = teapot_renderer_alloc(
+        &frames, RENDER_THREAD_STACK_SIZE, RENDER_THREAD_PRIORITY, frame_rendered, state);
 
     // Handle events
-    InputEvent event;
     bool running = true;
-    uint32_t last_auto_render = furi_get_tick();
-    uint32_t last_auto_rotate_update = furi_get_tick();
+    uint32_t next_frame_time = furi_get_tick(); // Next auto-rotation frame
+    bool input_pending = false; // Input applied but not yet presented
+    uint32_t input_ticks = 0; // Queue time of the oldest such input
     
     while(running) {
-        // Process input with timeout (non-blocking)
-        FuriStatus event_status = furi_message_queue_get(event_queue, &event, 0);
+        // Sleep until input arrives or the next frame is due. Without
+        // auto-rotation only the once-per-second stats window wakes the loop.
+        uint32_t timeout = FuriWaitForever;
+        if(!state->show_title_screen) {
+            uint32_t deadline = state->last_frame_time + 1000;
+            if(state->auto_rotate && (int32_t)(next_frame_time - deadline) < 0) {
+                deadline = next_frame_time;
+            }
+            int32_t remaining = (int32_t)(deadline - furi_get_tick());
+            timeout = remaining > 0 ? (uint32_t)remaining : 0;
+        }
+        
+        TeapotEvent event;
+        FuriStatus event_status = furi_message_queue_get(event_queue, &event, timeout);
+        uint32_t loop_start = profiler_ticks();
         
-        if(event_status == FuriStatusOk) {
+        // Drain everything that queued up meanwhile, so a burst of repeats
+        // is applied at once and costs a single render
+        while(event_status == FuriStatusOk && running) {
             if(furi_mutex_acquire(state->mutex, 100) == FuriStatusOk) {
-                // Check if we're in title screen mode
-                if(state->show_title_screen) {
-                    // Any button press exits title screen and starts the teapot renderer
-                    if(event.type == InputTypePress) {
-                        state->show_title_screen = false;
-                        FURI_LOG_I("P1X_SMOL_TEAPOT", "Exiting title screen");
-                        
-                        // Initialize the 3D renderer
-                        rotation.x = 0;
-                        rotation.y = 0;
-                        rotation.z = 0;
-                        render_needed = true;
-                        
-                        // Force multiple initial renders with slight rotations to ensure the entire model is drawn
-                        for(int i = 0; i < 5; i++) {
-                            rotation.y = i * 0.1f; // Slight rotation to ensure different faces are drawn
-                            render_complete_model(state);
-                            view_port_update(view_port);
-                            furi_delay_ms(20); // Short delay between frames
-                        }
-                        
-                        // Reset rotation to initial position
-                        rotation.x = 0;
-                        rotation.y = 0;
-                        rotation.z = 0;
-                        render_needed = true;
-                        
-                        // Final render to ensure model is complete
-                        render_complete_model(state);
-                        view_port_update(view_port);
-                    }
-                } else {
-                    // Process key presses and long presses for the teapot scene
-                    if(event.type == InputTypePress || event.type == InputTypeRepeat) {
-                        switch(event.key) {
-                            case InputKeyUp:
-                                rotation.x += 0.25f;
-                                render_needed = true;
-                                break;
-                            case InputKeyDown:
-                                rotation.x -= 0.25f;
-                                render_needed = true;
-                                break;
-                            case InputKeyLeft:
-                                rotation.y -= 0.25f;
-                                render_needed = true;
-                                break;
-                            case InputKeyRight:
-                                rotation.y += 0.25f;
-                                render_needed = true;
-                                break;
-                            case InputKeyOk:
-                                if(state->auto_rotate) {
-                                    // In auto-rotate mode, OK cycles through rotation axes
-                                    state->rotate_axis = (state->rotate_axis + 1) % 3; // Cycle through 0,1,2
-                                    FURI_LOG_I("P1X_SMOL_TEAPOT", "Auto-rotation axis: %c", 'X' + state->rotate_axis);
-                                    render_needed = true;
-                                } else {
-                                    // Normal mode - reset rotation
-                                    rotation.x = 0;
-                                    rotation.y = 0;
-                                    rotation.z = 0;
-                                    render_needed = true;
-                                }
-                                break;
-                            case InputKeyBack:
-                                running = false;
-                                break;
-                            default:
-                                break;
-                        }
-                    } else if(event.type == InputTypeLong) {
-                        // Long press handling
-                        switch(event.key) {
-                            case InputKeyOk:
-                                // Toggle auto-rotation mode
-                                state->auto_rotate = !state->auto_rotate;
-                                FURI_LOG_I("P1X_SMOL_TEAPOT", "Auto-rotation: %s", state->auto_rotate ? "ON" : "OFF");
-                                render_needed = true;
-                                break;
-                            default:
-                                break;
-                        }
-                    }
-                }
-                
+                running = process_input(state, &event.input);
                 furi_mutex_release(state->mutex);
             }
+            if(!input_pending) {
+                input_pending = true;
+                input_ticks = event.ticks;
+            }
+            event_status = furi_message_queue_get(event_queue, &event, 0);
         }
         
         // Only handle auto-rotation and rendering for teapot scene
         if(!state->show_title_screen) {
             uint32_t current_time = furi_get_tick();
             
-            // Update auto-rotation if enabled
-            if(state->auto_rotate && (current_time - last_auto_rotate_update >= 30)) { // Update at ~33fps
+            // Advance auto-rotation on a fixed schedule of frame deadlines,
+            // so render time does not stretch the frame period
+            if(state->auto_rotate && (int32_t)(current_time - next_frame_time) >= 0) {
+                next_frame_time += FRAME_DELAY;
+                // Drop missed frames instead of rendering a burst to catch up
+                if((int32_t)(current_time - next_frame_time) >= 0) {
+                    next_frame_time = current_time + FRAME_DELAY;
+                }
                 if(furi_mutex_acquire(state->mutex, 100) == FuriStatusOk) {
                     // Apply rotation to the selected axis
                     if(state->rotate_axis == 0) {
-                        rotation.x += state->auto_rotate_speed;
+                        camera.rotation.x += state->auto_rotate_speed;
                     } else if(state->rotate_axis == 1) {
-                        rotation.y += state->auto_rotate_speed;
+                        camera.rotation.y += state->auto_rotate_speed;
                     } else if(state->rotate_axis == 2) {
-                        rotation.z += state->auto_rotate_speed;
+                        camera.rotation.z += state->auto_rotate_speed;
                     }
-                    render_needed = true;
-                    last_auto_rotate_update = current_time;
                     furi_mutex_release(state->mutex);
                 }
             }
             
-            // Force a periodic re-render even without user input
-            // This ensures the model stays fully rendered
-            if(current_time - last_auto_render > 1000) {
-                render_needed = true;
-                last_auto_render = current_time;
-            }
+            // Hand the camera to the render thread only when it or the mode
+            // changed, a static scene costs no renders at all. The render
+            // thread updates the view port itself once the frame is done.
+            post_camera(state, input_pending, input_ticks);
+            input_pending = false;
             
-            // Check if we need to render a new frame
-            if(render_needed) {
-                // Render in our own buffer
-                render_complete_model(state);
-                
-                // Update frame count for FPS calculation
-                state->frame_count++;
-                
-                // Calculate FPS every second
-                uint32_t elapsed_time = current_time - state->last_frame_time;
-                
-                // Update FPS every second (1000ms)
-                if(elapsed_time >= 1000) {
-                    if(furi_mutex_acquire(state->mutex, 100) == FuriStatusOk) {
-                        state->fps = (state->frame_count * 1000) / elapsed_time;
-                        state->frame_count = 0;
-                        state->last_frame_time = current_time;
-                        furi_mutex_release(state->mutex);
-                    }
+            // Calculate FPS every second (1000ms), also while idle
+            uint32_t elapsed_time = current_time - state->last_frame_time;
+            if(elapsed_time >= 1000) {
+                bool log_needed = false;
+                if(furi_mutex_acquire(state->mutex, 100) == FuriStatusOk) {
+                    uint32_t fps = (state->frame_count * 1000) / elapsed_time;
+                    uint64_t window_ticks = (uint64_t)elapsed_time * 1000 * profiler_ticks_per_us();
+                    uint64_t busy_ticks = (uint64_t)state->busy_ticks + state->render_ticks;
+                    state->cpu_load = (uint32_t)(busy_ticks * 100 / window_ticks);
+                    state->busy_ticks = 0;
+                    state->render_ticks = 0;
+                    state->frame_count = 0;
+                    state->last_frame_time = current_time;
+                    
+                    // Start a new profiler window
+                    state->profile_shown = state->profile;
+                    frame_profile_reset(&state->profile);
+                    log_needed = state->show_profile;
+                    
+                    // Present only when the numbers on screen changed
+                    if(fps != state->fps || state->show_profile) display_needed = true;
+                    state->fps = fps;
+                    furi_mutex_release(state->mutex);
                 }
                 
-                // Update the display once per full model render
+                // profile_shown is only written by this thread
+                if(log_needed) log_profile(&state->profile_shown, state->cpu_load);
+            }
+            
+            // Present overlay changes, new frames are presented by the
+            // render thread
+            if(display_needed) {
+                display_needed = false;
                 view_port_update(view_port);
             }
         }
         
-        // Simple frame delay
-        furi_delay_ms(FRAME_DELAY);
+        // Busy time of this iteration, the queue wait above is idle
+        state->busy_ticks += profiler_ticks() - loop_start;
     }
     
-    // Clean up
+    // Clean up, the render thread goes first as it updates the view port
+    teapot_renderer_free(renderer);
     view_port_enabled_set(view_port, false);
     gui_remove_view_port(gui, view_port);
     furi_record_close(RECORD_GUI);
     view_port_free(view_port);
     furi_message_queue_free(event_queue);
     furi_mutex_free(state->mutex);
-    free_render_buffer();
+    teapot_engine_free();
+    free(asset_arena);
+    triple_buffer_free(&frames);
     free(state);
     
     return 0;
@@ -0,0 +1,223 @@
+#include "teapot_asset.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "teapot_lod.h"
+
+#ifdef TEAPOT_HOST
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <furi.h>
+#include <storage/storage.h>
+#endif
+
+#define ASSET_READ_CHUNK 4096 // Bytes per read from the file
+#define ASSET_SPHERE_SLACK 1.001f // Rounding allowed on the bounding sphere
+#define ASSET_NORMAL_SLACK 0.01f // Allowed deviation of squared normal lengths from 1
+
+_Static_assert(sizeof(TeapotAssetHeader) == 12, "TeapotAssetHeader must match the file layout");
+_Static_assert(sizeof(TeapotAssetLevel) == 116, "TeapotAssetLevel must match the file layout");
+_Static_assert(TEAPOT_ASSET_MAX_LEVELS <= TEAPOT_LOD_MAX, "An asset must fit teapot_lods_use()");
+
+// The file the loader reads in chunks: a Storage file on the SD card on the
+// Flipper, a read-only mapping of the file on the host
+#ifdef TEAPOT_HOST
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+} AssetFile;
+
+static bool asset_file_open(AssetFile* file, const char* path) {
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return false;
+    struct stat st;
+    void* data = MAP_FAILED;
+    if(fstat(fd, &st) == 0 && st.st_size > 0) {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping outlives the descriptor
+    close(fd);
+    if(data == MAP_FAILED) return false;
+
+    file->data = data;
+    file->size = (size_t)st.st_size;
+    file->position = 0;
+    return true;
+}
+
+static size_t asset_file_read(AssetFile* file, void* buffer, size_t bytes) {
+    size_t left = file->size - file->position;
+    if(bytes > left) bytes = left;
+    memcpy(buffer, file->data + file->position, bytes);
+    file->position += bytes;
+    return bytes;
+}
+
+static void asset_file_close(AssetFile* file) {
+    munmap((void*)file->data, file->size);
+}
+#else
+typedef struct {
+    Storage* storage;
+    File* file;
+    size_t size;
+} AssetFile;
+
+static bool asset_file_open(AssetFile* file, const char* path) {
+    file->storage = furi_record_open(RECORD_STORAGE);
+    file->file = storage_file_alloc(file->storage);
+    if(!storage_file_open(file->file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file->file);
+        furi_record_close(RECORD_STORAGE);
+        return false;
+    }
+    file->size = (size_t)storage_file_size(file->file);
+    return true;
+}
+
+static size_t asset_file_read(AssetFile* file, void* buffer, size_t bytes) {
+    return storage_file_read(file->file, buffer, bytes);
+}
+
+static void asset_file_close(AssetFile* file) {
+    storage_file_close(file->file);
+    storage_file_free(file->file);
+    furi_record_close(RECORD_STORAGE);
+}
+#endif
+
+// Whether count elements of element_size bytes at offset are aligned and
+// inside a file of size bytes
+static bool section_valid(uint32_t offset, size_t count, size_t element_size, size_t size) {
+    return offset % TEAPOT_ASSET_ALIGN == 0 && offset <= size && count * element_size <= size - offset;
+}
+
+static bool all_finite(const float* values, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        if(!isfinite(values[i])) return false;
+    }
+    return true;
+}
+
+// Check a level record and its arrays for what the renderer relies on
+// without checks: indices in range, clusters covering the triangles, unit
+// normals, a vertex scale and a model within TEAPOT_ASSET_MAX_REACH of
+// the origin
+static bool level_valid(const TeapotAssetLevel* level, const uint8_t* data, size_t size) {
+    if(level->name[TEAPOT_ASSET_NAME_SIZE - 1] != '\0') return false;
+    if(!isfinite(level->vertex_scale) || !all_finite(level->bounding_sphere, 4)) return false;
+    const float* sphere = level->bounding_sphere;
+    float center = sqrtf(sphere[0] * sphere[0] + sphere[1] * sphere[1] + sphere[2] * sphere[2]);
+    if(!(level->vertex_scale > 0) || !(sphere[3] > 0) || center + sphere[3] > TEAPOT_ASSET_MAX_REACH) return false;
+    // Any int16 vertex times the scale stays in reach, whatever the sphere says
+    if(level->vertex_scale * INT16_MAX > TEAPOT_ASSET_MAX_REACH) return false;
+    if(level->vertex_count == 0 || level->triangle_count == 0 || level->triangle_count >= TEAPOT_NO_FACE) {
+        return false;
+    }
+    if(!section_valid(level->vertices, level->vertex_count * 3u, sizeof(int16_t), size) ||
+       !section_valid(level->indices, level->triangle_count * 3u, sizeof(uint16_t), size) ||
+       !section_valid(level->face_planes, level->triangle_count * 4u, sizeof(float), size) ||
+       !section_valid(level->clusters, level->cluster_count * 2u, sizeof(uint16_t), size) ||
+       !section_valid(level->cluster_bounds, level->cluster_count * 9u, sizeof(float), size) ||
+       !section_valid(level->edges, level->edge_count * 4u, sizeof(uint16_t), size) ||
+       !section_valid(level->edge_flags, level->edge_count, sizeof(uint8_t), size)) {
+        return false;
+    }
+
+    // Every vertex inside the bounding sphere, which bounds the scale too
+    const int16_t* vertices = (const int16_t*)(data + level->vertices);
+    float radius = sphere[3] * ASSET_SPHERE_SLACK;
+    for(int i = 0; i < level->vertex_count; i++) {
+        float dx = vertices[i * 3] * level->vertex_scale - sphere[0];
+        float dy = vertices[i * 3 + 1] * level->vertex_scale - sphere[1];
+        float dz = vertices[i * 3 + 2] * level->vertex_scale - sphere[2];
+        if(dx * dx + dy * dy + dz * dz > radius * radius) return false;
+    }
+    const float* planes = (const float*)(data + level->face_planes);
+    for(int i = 0; i < level->triangle_count; i++) {
+        const float* p = &planes[i * 4];
+        float length_sq = p[0] * p[0] + p[1] * p[1] + p[2] * p[2];
+        if(!(fabsf(length_sq - 1) <= ASSET_NORMAL_SLACK) || !(fabsf(p[3]) <= TEAPOT_ASSET_MAX_REACH)) return false;
+    }
+    if(!all_finite((const float*)(data + level->cluster_bounds), level->cluster_count * 9u)) return false;
+
+    const uint16_t* indices = (const uint16_t*)(data + level->indices);
+    for(int i = 0; i < level->triangle_count * 3; i++) {
+        if(indices[i] >= level->vertex_count) return false;
+    }
+    // Culling visits triangles by cluster, so the clusters have to cover
+    // all of them in order
+    const uint16_t* clusters = (const uint16_t*)(data + level->clusters);
+    int covered = 0;
+    for(int i = 0; i < level->cluster_count; i++) {
+        if(clusters[i * 2] != covered || clusters[i * 2 + 1] == 0) return false;
+        covered += clusters[i * 2 + 1];
+    }
+    if(covered != level->triangle_count) return false;
+    const uint16_t* edges = (const uint16_t*)(data + level->edges);
+    for(int i = 0; i < level->edge_count; i++) {
+        const uint16_t* e = &edges[i * 4];
+        if(e[0] >= level->vertex_count || e[1] >= level->vertex_count || e[2] >= level->triangle_count) return false;
+        if(e[3] >= level->triangle_count && e[3] != TEAPOT_NO_FACE) return false;
+    }
+    return true;
+}
+
+bool teapot_asset_load(TeapotAsset* asset, const char* path, uint8_t* arena, size_t arena_size) {
+    asset->level_count = 0;
+    if((uintptr_t)arena % TEAPOT_ASSET_ALIGN) return false;
+
+    AssetFile file;
+    if(!asset_file_open(&file, path)) return false;
+    size_t size = file.size;
+    bool complete = size >= sizeof(TeapotAssetHeader) && size <= arena_size;
+    for(size_t done = 0; complete && done < size;) {
+        size_t chunk = size - done < ASSET_READ_CHUNK ? size - done : ASSET_READ_CHUNK;
+        complete = asset_file_read(&file, arena + done, chunk) == chunk;
+        done += chunk;
+    }
+    asset_file_close(&file);
+    if(!complete) return false;
+
+    const TeapotAssetHeader* header = (const TeapotAssetHeader*)arena;
+    if(header->magic != TEAPOT_ASSET_MAGIC || header->version != TEAPOT_ASSET_VERSION || header->size != size) {
+        return false;
+    }
+    if(header->level_count == 0 || header->level_count > TEAPOT_ASSET_MAX_LEVELS ||
+       sizeof(TeapotAssetHeader) + header->level_count * sizeof(TeapotAssetLevel) > size) {
+        return false;
+    }
+
+    const TeapotAssetLevel* records = (const TeapotAssetLevel*)(arena + sizeof(TeapotAssetHeader));
+    for(int i = 0; i < header->level_count; i++) {
+        const TeapotAssetLevel* level = &records[i];
+        if(!level_valid(level, arena, size)) return false;
+
+        TeapotMesh* mesh = &asset->meshes[i];
+        mesh->name = level->name;
+        mesh->vertex_count = level->vertex_count;
+        mesh->triangle_count = level->triangle_count;
+        mesh->edge_count = level->edge_count;
+        mesh->cluster_count = level->cluster_count;
+        mesh->vertices = (const int16_t*)(arena + level->vertices);
+        mesh->vertex_scale = level->vertex_scale;
+        memcpy(mesh->bounds_min, level->bounds_min, sizeof(mesh->bounds_min));
+        memcpy(mesh->bounds_max, level->bounds_max, sizeof(mesh->bounds_max));
+        memcpy(mesh->centroid, level->centroid, sizeof(mesh->centroid));
+        memcpy(mesh->bounding_sphere, level->bounding_sphere, sizeof(mesh->bounding_sphere));
+        mesh->indices = (const uint16_t*)(arena + level->indices);
+        mesh->face_planes = (const float*)(arena + level->face_planes);
+        mesh->clusters = (const uint16_t*)(arena + level->clusters);
+        mesh->cluster_bounds = (const float*)(arena + level->cluster_bounds);
+        mesh->edges = (const uint16_t*)(arena + level->edges);
+        mesh->edge_flags = arena + level->edge_flags;
+        asset->levels[i] = mesh;
+    }
+    asset->level_count = (uint8_t)header->level_count;
+    return true;
+}
@@ -0,0 +1,82 @@
+#ifndef TEAPOT_ASSET_H
+#define TEAPOT_ASSET_H
+
+/*
+ * Binary mesh assets: a chain of levels of detail in one file that the app
+ * loads from the SD card at run time, so models can change without a
+ * rebuild and do not take flash. obj_to_teapot_header.c writes them with -b.
+ *
+ * A file is a TeapotAssetHeader, level_count TeapotAssetLevel records and
+ * the arrays of each level in the layout of the TeapotMesh fields they fill
+ * (teapot_mesh.h), each starting at a multiple of TEAPOT_ASSET_ALIGN bytes.
+ * Values are little-endian, the byte order of the Flipper and the host, so
+ * a file read into aligned memory is used in place. The loader reads the
+ * whole file into a caller-provided arena in fixed-size chunks, checks every
+ * offset, count and index, then points the meshes into the arena: nothing is
+ * allocated per element and a damaged file is refused instead of drawn.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "teapot_mesh.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Mesh assets are little-endian"
+#endif
+
+#define TEAPOT_ASSET_MAGIC 0x544F5054 // "TPOT" read as a little-endian uint32
+#define TEAPOT_ASSET_VERSION 1
+#define TEAPOT_ASSET_MAX_LEVELS 8
+#define TEAPOT_ASSET_NAME_SIZE 24 // Level name including the terminating NUL
+#define TEAPOT_ASSET_ALIGN 4 // Array offsets are multiples of this
+#define TEAPOT_ASSET_MAX_REACH 8.0f // Farthest model point from the origin, the fixed-point range
+
+// Arena the app and the host build read assets into
+#ifndef TEAPOT_ASSET_ARENA_SIZE
+#define TEAPOT_ASSET_ARENA_SIZE (64 * 1024)
+#endif
+
+typedef struct {
+    uint32_t magic; // TEAPOT_ASSET_MAGIC
+    uint16_t version; // TEAPOT_ASSET_VERSION
+    uint16_t level_count;
+    uint32_t size; // Whole file in bytes
+} TeapotAssetHeader;
+
+// One level, the array fields are byte offsets from the start of the file
+typedef struct {
+    char name[TEAPOT_ASSET_NAME_SIZE];
+    uint16_t vertex_count;
+    uint16_t triangle_count;
+    uint16_t edge_count;
+    uint16_t cluster_count;
+    float vertex_scale;
+    float bounds_min[3];
+    float bounds_max[3];
+    float centroid[3];
+    float bounding_sphere[4];
+    uint32_t vertices; // 3 int16 per vertex
+    uint32_t indices; // 3 uint16 per triangle
+    uint32_t face_planes; // 4 floats per triangle
+    uint32_t clusters; // 2 uint16 per cluster
+    uint32_t cluster_bounds; // 9 floats per cluster
+    uint32_t edges; // 4 uint16 per edge
+    uint32_t edge_flags; // 1 uint8 per edge
+} TeapotAssetLevel;
+
+// Levels of a loaded asset, their arrays point into the arena
+typedef struct {
+    TeapotMesh meshes[TEAPOT_ASSET_MAX_LEVELS];
+    const TeapotMesh* levels[TEAPOT_ASSET_MAX_LEVELS]; // Finest first, for teapot_lods_use()
+    uint8_t level_count;
+} TeapotAsset;
+
+// Read the asset at path into arena, which must be 4-byte aligned and stay
+// allocated while the meshes are in use. Returns false when the file cannot
+// be opened, is larger than arena_size or fails a check. On the Flipper path
+// is a Storage path, on the host the file is read through mmap.
+bool teapot_asset_load(TeapotAsset* asset, const char* path, uint8_t* arena, size_t arena_size);
+
+#endif // TEAPOT_ASSET_H
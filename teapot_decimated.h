@@ -1,706 +1,2200 @@
 #ifndef TEAPOT_DECIMATED_H
 #define TEAPOT_DECIMATED_H
 
-#define TEAPOT_TRIANGLE_COUNT 347 // Updated count from /Code/smol-teapot/teapot_smol.obj
+#include "teapot_mesh.h"
 
-// Teapot vertices as array of triangles
-// Each triangle is 9 floats (3 vertices * 3 coordinates)
-// Data derived from /Code/smol-teapot/teapot_smol.obj
-static const float teapot_triangles[] = {
-    // f 1 3 2
-    -0.140993f, 0.594620f, -1.994492f, -0.505363f, 1.237329f, -1.886869f, 0.198274f, 1.206828f, -1.951940f,
-    // f 1 2 4
-    -0.140993f, 0.594620f, -1.994492f, 0.198274f, 1.206828f, -1.951940f, 0.602236f, 0.623771f, -1.916205f,
-    // f 1 5 3
-    -0.140993f, 0.594620f, -1.994492f, -0.937508f, 0.773670f, -1.797898f, -0.505363f, 1.237329f, -1.886869f,
-    // f 1 4 7
-    -0.140993f, 0.594620f, -1.994492f, 0.602236f, 0.623771f, -1.916205f, 0.211207f, 0.288276f, -1.806472f,
-    // f 1 7 8
-    -0.140993f, 0.594620f, -1.994492f, 0.211207f, 0.288276f, -1.806472f, -0.642186f, 0.314516f, -1.743026f,
-    // f 2 6 4
-    0.198274f, 1.206828f, -1.951940f, 0.866135f, 1.291838f, -1.728728f, 0.602236f, 0.623771f, -1.916205f,
-    // f 1 8 5
-    -0.140993f, 0.594620f, -1.994492f, -0.642186f, 0.314516f, -1.743026f, -0.937508f, 0.773670f, -1.797898f,
-    // f 4 9 7
-    0.602236f, 0.623771f, -1.916205f, 0.878191f, 0.340951f, -1.653900f, 0.211207f, 0.288276f, -1.806472f,
-    // f 8 15 5
-    -0.642186f, 0.314516f, -1.743026f, -1.365875f, 0.660896f, -1.503271f, -0.937508f, 0.773670f, -1.797898f,
-    // f 4 6 10
-    0.602236f, 0.623771f, -1.916205f, 0.866135f, 1.291838f, -1.728728f, 1.350826f, 0.769986f, -1.509054f,
-    // f 4 10 24
-    0.602236f, 0.623771f, -1.916205f, 1.350826f, 0.769986f, -1.509054f, 1.360500f, 0.497674f, -1.430236f,
-    // f 4 24 9
-    0.602236f, 0.623771f, -1.916205f, 1.360500f, 0.497674f, -1.430236f, 0.878191f, 0.340951f, -1.653900f,
-    // f 5 11 3
-    -0.937508f, 0.773670f, -1.797898f, -1.180817f, 1.512249f, -1.420951f, -0.505363f, 1.237329f, -1.886869f,
-    // f 2 3 12
-    0.198274f, 1.206828f, -1.951940f, -0.505363f, 1.237329f, -1.886869f, 0.113226f, 2.359001f, -1.419763f,
-    // f 3 13 12
-    -0.505363f, 1.237329f, -1.886869f, -0.441604f, 2.317152f, -1.401470f, 0.113226f, 2.359001f, -1.419763f,
-    // f 7 14 8
-    0.211207f, 0.288276f, -1.806472f, 0.035080f, 0.007065f, -1.522679f, -0.642186f, 0.314516f, -1.743026f,
-    // f 2 12 6
-    0.198274f, 1.206828f, -1.951940f, 0.113226f, 2.359001f, -1.419763f, 0.866135f, 1.291838f, -1.728728f,
-    // f 7 9 14
-    0.211207f, 0.288276f, -1.806472f, 0.878191f, 0.340951f, -1.653900f, 0.035080f, 0.007065f, -1.522679f,
-    // f 6 12 16
-    0.866135f, 1.291838f, -1.728728f, 0.113226f, 2.359001f, -1.419763f, 0.921125f, 2.335166f, -1.151940f,
-    // f 8 14 18
-    -0.642186f, 0.314516f, -1.743026f, 0.035080f, 0.007065f, -1.522679f, -0.924843f, 0.008583f, -1.217812f,
-    // f 9 17 14
-    0.878191f, 0.340951f, -1.653900f, 0.812388f, 0.008138f, -1.272795f, 0.035080f, 0.007065f, -1.522679f,
-    // f 6 19 10
-    0.866135f, 1.291838f, -1.728728f, 1.385840f, 1.528987f, -1.207676f, 1.350826f, 0.769986f, -1.509054f,
-    // f 3 11 13
-    -0.505363f, 1.237329f, -1.886869f, -1.180817f, 1.512249f, -1.420951f, -0.441604f, 2.317152f, -1.401470f,
-    // f 8 20 15
-    -0.642186f, 0.314516f, -1.743026f, -1.431836f, 0.334693f, -1.195959f, -1.365875f, 0.660896f, -1.503271f,
-    // f 5 15 11
-    -0.937508f, 0.773670f, -1.797898f, -1.365875f, 0.660896f, -1.503271f, -1.180817f, 1.512249f, -1.420951f,
-    // f 11 22 13
-    -1.180817f, 1.512249f, -1.420951f, -0.994090f, 2.345317f, -1.068290f, -0.441604f, 2.317152f, -1.401470f,
-    // f 24 23 9
-    1.360500f, 0.497674f, -1.430236f, 1.541500f, 0.242328f, -0.913087f, 0.878191f, 0.340951f, -1.653900f,
-    // f 14 21 18
-    0.035080f, 0.007065f, -1.522679f, -1.487463f, 0.002157f, -0.329736f, -0.924843f, 0.008583f, -1.217812f,
-    // f 14 17 21
-    0.035080f, 0.007065f, -1.522679f, 0.812388f, 0.008138f, -1.272795f, -1.487463f, 0.002157f, -0.329736f,
-    // f 8 18 20
-    -0.642186f, 0.314516f, -1.743026f, -0.924843f, 0.008583f, -1.217812f, -1.431836f, 0.334693f, -1.195959f,
-    // f 12 13 22
-    0.113226f, 2.359001f, -1.419763f, -0.441604f, 2.317152f, -1.401470f, -0.994090f, 2.345317f, -1.068290f,
-    // f 25 12 26
-    0.263661f, 2.211477f, -1.355129f, 0.113226f, 2.359001f, -1.419763f, -0.255647f, 2.211497f, -1.364666f,
-    // f 12 22 28
-    0.113226f, 2.359001f, -1.419763f, -0.994090f, 2.345317f, -1.068290f, -0.778397f, 2.331782f, -1.172388f,
-    // f 12 28 26
-    0.113226f, 2.359001f, -1.419763f, -0.778397f, 2.331782f, -1.172388f, -0.255647f, 2.211497f, -1.364666f,
-    // f 12 27 16
-    0.113226f, 2.359001f, -1.419763f, 0.836606f, 2.348808f, -1.135435f, 0.921125f, 2.335166f, -1.151940f,
-    // f 25 27 12
-    0.263661f, 2.211477f, -1.355129f, 0.836606f, 2.348808f, -1.135435f, 0.113226f, 2.359001f, -1.419763f,
-    // f 26 29 25
-    -0.255647f, 2.211497f, -1.364666f, -0.061998f, 2.294824f, -1.285897f, 0.263661f, 2.211477f, -1.355129f,
-    // f 6 16 19
-    0.866135f, 1.291838f, -1.728728f, 0.921125f, 2.335166f, -1.151940f, 1.385840f, 1.528987f, -1.207676f,
-    // f 26 30 29
-    -0.255647f, 2.211497f, -1.364666f, -0.609361f, 2.305116f, -1.132420f, -0.061998f, 2.294824f, -1.285897f,
-    // f 25 29 31
-    0.263661f, 2.211477f, -1.355129f, -0.061998f, 2.294824f, -1.285897f, 0.511809f, 2.307791f, -1.177356f,
-    // f 26 28 32
-    -0.255647f, 2.211497f, -1.364666f, -0.778397f, 2.331782f, -1.172388f, -1.031690f, 2.214918f, -0.959141f,
-    // f 25 33 27
-    0.263661f, 2.211477f, -1.355129f, 0.779496f, 2.213080f, -1.146198f, 0.836606f, 2.348808f, -1.135435f,
-    // f 9 23 17
-    0.878191f, 0.340951f, -1.653900f, 1.541500f, 0.242328f, -0.913087f, 0.812388f, 0.008138f, -1.272795f,
-    // f 10 34 24
-    1.350826f, 0.769986f, -1.509054f, 1.858307f, 0.683209f, -0.823335f, 1.360500f, 0.497674f, -1.430236f,
-    // f 10 19 34
-    1.350826f, 0.769986f, -1.509054f, 1.385840f, 1.528987f, -1.207676f, 1.858307f, 0.683209f, -0.823335f,
-    // f 15 35 11
-    -1.365875f, 0.660896f, -1.503271f, -1.618353f, 1.266507f, -1.057958f, -1.180817f, 1.512249f, -1.420951f,
-    // f 23 46 17
-    1.541500f, 0.242328f, -0.913087f, 1.300532f, 0.009026f, -0.773200f, 0.812388f, 0.008138f, -1.272795f,
-    // f 15 39 35
-    -1.365875f, 0.660896f, -1.503271f, -1.878508f, 0.690343f, -0.729976f, -1.618353f, 1.266507f, -1.057958f,
-    // f 26 32 30
-    -0.255647f, 2.211497f, -1.364666f, -1.031690f, 2.214918f, -0.959141f, -0.609361f, 2.305116f, -1.132420f,
-    // f 25 31 33
-    0.263661f, 2.211477f, -1.355129f, 0.511809f, 2.307791f, -1.177356f, 0.779496f, 2.213080f, -1.146198f,
-    // f 29 36 31
-    -0.061998f, 2.294824f, -1.285897f, -0.273816f, 2.492922f, -0.205807f, 0.511809f, 2.307791f, -1.177356f,
-    // f 29 30 36
-    -0.061998f, 2.294824f, -1.285897f, -0.609361f, 2.305116f, -1.132420f, -0.273816f, 2.492922f, -0.205807f,
-    // f 11 35 22
-    -1.180817f, 1.512249f, -1.420951f, -1.618353f, 1.266507f, -1.057958f, -0.994090f, 2.345317f, -1.068290f,
-    // f 19 37 34
-    1.385840f, 1.528987f, -1.207676f, 1.731321f, 1.513067f, -0.645840f, 1.858307f, 0.683209f, -0.823335f,
-    // f 32 38 30
-    -1.031690f, 2.214918f, -0.959141f, -0.988833f, 2.247851f, -0.872931f, -0.609361f, 2.305116f, -1.132420f,
-    // f 17 46 21
-    0.812388f, 0.008138f, -1.272795f, 1.300532f, 0.009026f, -0.773200f, -1.487463f, 0.002157f, -0.329736f,
-    // f 31 40 33
-    0.511809f, 2.307791f, -1.177356f, 0.998289f, 2.313215f, -0.812102f, 0.779496f, 2.213080f, -1.146198f,
-    // f 15 20 39
-    -1.365875f, 0.660896f, -1.503271f, -1.431836f, 0.334693f, -1.195959f, -1.878508f, 0.690343f, -0.729976f,
-    // f 20 41 39
-    -1.431836f, 0.334693f, -1.195959f, -1.789813f, 0.357255f, -0.593009f, -1.878508f, 0.690343f, -0.729976f,
-    // f 35 42 22
-    -1.618353f, 1.266507f, -1.057958f, -1.364717f, 2.355640f, -0.483351f, -0.994090f, 2.345317f, -1.068290f,
-    // f 24 34 23
-    1.360500f, 0.497674f, -1.430236f, 1.858307f, 0.683209f, -0.823335f, 1.541500f, 0.242328f, -0.913087f,
-    // f 19 16 44
-    1.385840f, 1.528987f, -1.207676f, 0.921125f, 2.335166f, -1.151940f, 1.333869f, 2.324509f, -0.606731f,
-    // f 33 43 27
-    0.779496f, 2.213080f, -1.146198f, 1.279435f, 2.211809f, -0.566152f, 0.836606f, 2.348808f, -1.135435f,
-    // f 33 40 43
-    0.779496f, 2.213080f, -1.146198f, 0.998289f, 2.313215f, -0.812102f, 1.279435f, 2.211809f, -0.566152f,
-    // f 39 45 35
-    -1.878508f, 0.690343f, -0.729976f, -1.870902f, 1.281367f, -0.507106f, -1.618353f, 1.266507f, -1.057958f,
-    // f 18 21 20
-    -0.924843f, 0.008583f, -1.217812f, -1.487463f, 0.002157f, -0.329736f, -1.431836f, 0.334693f, -1.195959f,
-    // f 19 44 37
-    1.385840f, 1.528987f, -1.207676f, 1.333869f, 2.324509f, -0.606731f, 1.731321f, 1.513067f, -0.645840f,
-    // f 35 45 42
-    -1.618353f, 1.266507f, -1.057958f, -1.870902f, 1.281367f, -0.507106f, -1.364717f, 2.355640f, -0.483351f,
-    // f 20 21 41
-    -1.431836f, 0.334693f, -1.195959f, -1.487463f, 0.002157f, -0.329736f, -1.789813f, 0.357255f, -0.593009f,
-    // f 22 47 28
-    -0.994090f, 2.345317f, -1.068290f, -1.351349f, 2.284267f, -0.368191f, -0.778397f, 2.331782f, -1.172388f,
-    // f 43 16 27
-    1.279435f, 2.211809f, -0.566152f, 0.921125f, 2.335166f, -1.151940f, 0.836606f, 2.348808f, -1.135435f,
-    // f 36 48 31
-    -0.273816f, 2.492922f, -0.205807f, 0.104173f, 2.509992f, -0.239106f, 0.511809f, 2.307791f, -1.177356f,
-    // f 28 47 32
-    -0.778397f, 2.331782f, -1.172388f, -1.351349f, 2.284267f, -0.368191f, -1.031690f, 2.214918f, -0.959141f,
-    // f 38 54 30
-    -0.988833f, 2.247851f, -0.872931f, -1.210947f, 2.297810f, -0.430263f, -0.609361f, 2.305116f, -1.132420f,
-    // f 31 48 40
-    0.511809f, 2.307791f, -1.177356f, 0.104173f, 2.509992f, -0.239106f, 0.998289f, 2.313215f, -0.812102f,
-    // f 43 52 16
-    1.279435f, 2.211809f, -0.566152f, 1.417603f, 2.355075f, -0.111609f, 0.921125f, 2.335166f, -1.151940f,
-    // f 30 54 36
-    -0.609361f, 2.305116f, -1.132420f, -1.210947f, 2.297810f, -0.430263f, -0.273816f, 2.492922f, -0.205807f,
-    // f 32 53 38
-    -1.031690f, 2.214918f, -0.959141f, -1.396562f, 2.216265f, -0.016180f, -0.988833f, 2.247851f, -0.872931f,
-    // f 40 48 50
-    0.998289f, 2.313215f, -0.812102f, 0.104173f, 2.509992f, -0.239106f, 0.298712f, 2.505079f, 0.099156f,
-    // f 22 42 47
-    -0.994090f, 2.345317f, -1.068290f, -1.364717f, 2.355640f, -0.483351f, -1.351349f, 2.284267f, -0.368191f,
-    // f 16 52 44
-    0.921125f, 2.335166f, -1.151940f, 1.417603f, 2.355075f, -0.111609f, 1.333869f, 2.324509f, -0.606731f,
-    // f 32 47 53
-    -1.031690f, 2.214918f, -0.959141f, -1.351349f, 2.284267f, -0.368191f, -1.396562f, 2.216265f, -0.016180f,
-    // f 53 54 38
-    -1.396562f, 2.216265f, -0.016180f, -1.210947f, 2.297810f, -0.430263f, -0.988833f, 2.247851f, -0.872931f,
-    // f 34 37 51
-    1.858307f, 0.683209f, -0.823335f, 1.731321f, 1.513067f, -0.645840f, 1.931767f, 0.889893f, -0.528304f,
-    // f 40 49 43
-    0.998289f, 2.313215f, -0.812102f, 1.234779f, 2.296869f, -0.356356f, 1.279435f, 2.211809f, -0.566152f,
-    // f 23 55 46
-    1.541500f, 0.242328f, -0.913087f, 1.528330f, 0.007339f, 0.129047f, 1.300532f, 0.009026f, -0.773200f,
-    // f 46 55 21
-    1.300532f, 0.009026f, -0.773200f, 1.528330f, 0.007339f, 0.129047f, -1.487463f, 0.002157f, -0.329736f,
-    // f 34 56 23
-    1.858307f, 0.683209f, -0.823335f, 1.825814f, 0.282648f, 0.042818f, 1.541500f, 0.242328f, -0.913087f,
-    // f 39 64 45
-    -1.878508f, 0.690343f, -0.729976f, -2.007656f, 0.720078f, -0.130077f, -1.870902f, 1.281367f, -0.507106f,
-    // f 23 56 55
-    1.541500f, 0.242328f, -0.913087f, 1.825814f, 0.282648f, 0.042818f, 1.528330f, 0.007339f, 0.129047f,
-    // f 51 60 34
-    1.931767f, 0.889893f, -0.528304f, 1.951454f, 0.540374f, -0.254847f, 1.858307f, 0.683209f, -0.823335f,
-    // f 51 57 62
-    1.931767f, 0.889893f, -0.528304f, 2.502562f, 1.208656f, -0.410314f, 2.335411f, 0.725993f, -0.263016f,
-    // f 37 59 51
-    1.731321f, 1.513067f, -0.645840f, 1.907254f, 1.276959f, -0.188708f, 1.931767f, 0.889893f, -0.528304f,
-    // f 43 49 58
-    1.279435f, 2.211809f, -0.566152f, 1.234779f, 2.296869f, -0.356356f, 1.400451f, 2.216063f, 0.177075f,
-    // f 57 51 61
-    2.502562f, 1.208656f, -0.410314f, 1.931767f, 0.889893f, -0.528304f, 2.241828f, 1.336738f, -0.294247f,
-    // f 51 62 60
-    1.931767f, 0.889893f, -0.528304f, 2.335411f, 0.725993f, -0.263016f, 1.951454f, 0.540374f, -0.254847f,
-    // f 51 59 61
-    1.931767f, 0.889893f, -0.528304f, 1.907254f, 1.276959f, -0.188708f, 2.241828f, 1.336738f, -0.294247f,
-    // f 44 52 37
-    1.333869f, 2.324509f, -0.606731f, 1.417603f, 2.355075f, -0.111609f, 1.731321f, 1.513067f, -0.645840f,
-    // f 39 65 64
-    -1.878508f, 0.690343f, -0.729976f, -1.967287f, 0.588401f, -0.233282f, -2.007656f, 0.720078f, -0.130077f,
-    // f 39 41 65
-    -1.878508f, 0.690343f, -0.729976f, -1.789813f, 0.357255f, -0.593009f, -1.967287f, 0.588401f, -0.233282f,
-    // f 34 60 56
-    1.858307f, 0.683209f, -0.823335f, 1.951454f, 0.540374f, -0.254847f, 1.825814f, 0.282648f, 0.042818f,
-    // f 57 69 68
-    2.502562f, 1.208656f, -0.410314f, 2.890284f, 2.294064f, -0.168990f, 2.846714f, 2.050428f, -0.189403f,
-    // f 57 61 69
-    2.502562f, 1.208656f, -0.410314f, 2.241828f, 1.336738f, -0.294247f, 2.890284f, 2.294064f, -0.168990f,
-    // f 63 70 66
-    -0.070988f, 2.925693f, -0.385651f, 0.298779f, 2.969820f, -0.187167f, 0.214824f, 2.887259f, -0.307229f,
-    // f 63 66 71
-    -0.070988f, 2.925693f, -0.385651f, 0.214824f, 2.887259f, -0.307229f, 0.010703f, 2.609281f, -0.169423f,
-    // f 45 82 42
-    -1.870902f, 1.281367f, -0.507106f, -1.604720f, 1.992744f, -0.235272f, -1.364717f, 2.355640f, -0.483351f,
-    // f 63 72 70
-    -0.070988f, 2.925693f, -0.385651f, -0.326103f, 2.956401f, -0.216785f, 0.298779f, 2.969820f, -0.187167f,
-    // f 61 74 69
-    2.241828f, 1.336738f, -0.294247f, 2.632503f, 2.224633f, -0.070638f, 2.890284f, 2.294064f, -0.168990f,
-    // f 40 67 49
-    0.998289f, 2.313215f, -0.812102f, 1.259740f, 2.321436f, 0.172469f, 1.234779f, 2.296869f, -0.356356f,
-    // f 63 75 72
-    -0.070988f, 2.925693f, -0.385651f, -0.167942f, 2.604722f, -0.008915f, -0.326103f, 2.956401f, -0.216785f,
-    // f 63 71 75
-    -0.070988f, 2.925693f, -0.385651f, 0.010703f, 2.609281f, -0.169423f, -0.167942f, 2.604722f, -0.008915f,
-    // f 57 68 76
-    2.502562f, 1.208656f, -0.410314f, 2.846714f, 2.050428f, -0.189403f, 2.944266f, 2.031809f, -0.071125f,
-    // f 62 57 77
-    2.335411f, 0.725993f, -0.263016f, 2.502562f, 1.208656f, -0.410314f, 2.629748f, 1.058343f, 0.045275f,
-    // f 41 78 65
-    -1.789813f, 0.357255f, -0.593009f, -1.914636f, 0.426089f, 0.003811f, -1.967287f, 0.588401f, -0.233282f,
-    // f 61 73 74
-    2.241828f, 1.336738f, -0.294247f, 2.366578f, 1.602510f, -0.099890f, 2.632503f, 2.224633f, -0.070638f,
-    // f 41 79 78
-    -1.789813f, 0.357255f, -0.593009f, -1.820856f, 0.297554f, 0.207656f, -1.914636f, 0.426089f, 0.003811f,
-    // f 48 36 71
-    0.104173f, 2.509992f, -0.239106f, -0.273816f, 2.492922f, -0.205807f, 0.010703f, 2.609281f, -0.169423f,
-    // f 53 80 54
-    -1.396562f, 2.216265f, -0.016180f, -1.255039f, 2.321482f, 0.264606f, -1.210947f, 2.297810f, -0.430263f,
-    // f 37 81 59
-    1.731321f, 1.513067f, -0.645840f, 1.919868f, 1.275235f, 0.187860f, 1.907254f, 1.276959f, -0.188708f,
-    // f 37 52 81
-    1.731321f, 1.513067f, -0.645840f, 1.417603f, 2.355075f, -0.111609f, 1.919868f, 1.275235f, 0.187860f,
-    // f 40 50 67
-    0.998289f, 2.313215f, -0.812102f, 0.298712f, 2.505079f, 0.099156f, 1.259740f, 2.321436f, 0.172469f,
-    // f 41 21 79
-    -1.789813f, 0.357255f, -0.593009f, -1.487463f, 0.002157f, -0.329736f, -1.820856f, 0.297554f, 0.207656f,
-    // f 84 86 83
-    -2.475875f, 0.842815f, -0.216794f, -2.800261f, 1.186742f, -0.216808f, -2.603851f, 1.158914f, -0.190211f,
-    // f 82 85 87
-    -1.604720f, 1.992744f, -0.235272f, -2.739104f, 1.901744f, -0.230341f, -2.747542f, 2.010613f, -0.158862f,
-    // f 85 86 91
-    -2.739104f, 1.901744f, -0.230341f, -2.800261f, 1.186742f, -0.216808f, -2.963567f, 1.763224f, -0.166606f,
-    // f 86 85 88
-    -2.800261f, 1.186742f, -0.216808f, -2.739104f, 1.901744f, -0.230341f, -2.714429f, 1.706103f, -0.131958f,
-    // f 86 88 83
-    -2.800261f, 1.186742f, -0.216808f, -2.714429f, 1.706103f, -0.131958f, -2.603851f, 1.158914f, -0.190211f,
-    // f 65 84 83
-    -1.967287f, 0.588401f, -0.233282f, -2.475875f, 0.842815f, -0.216794f, -2.603851f, 1.158914f, -0.190211f,
-    // f 65 83 64
-    -1.967287f, 0.588401f, -0.233282f, -2.603851f, 1.158914f, -0.190211f, -2.007656f, 0.720078f, -0.130077f,
-    // f 54 80 36
-    -1.210947f, 2.297810f, -0.430263f, -1.255039f, 2.321482f, 0.264606f, -0.273816f, 2.492922f, -0.205807f,
-    // f 66 89 71
-    0.214824f, 2.887259f, -0.307229f, 0.387869f, 2.912241f, -0.035719f, 0.010703f, 2.609281f, -0.169423f,
-    // f 36 75 71
-    -0.273816f, 2.492922f, -0.205807f, -0.167942f, 2.604722f, -0.008915f, 0.010703f, 2.609281f, -0.169423f,
-    // f 66 70 89
-    0.214824f, 2.887259f, -0.307229f, 0.298779f, 2.969820f, -0.187167f, 0.387869f, 2.912241f, -0.035719f,
-    // f 87 90 82
-    -2.747542f, 2.010613f, -0.158862f, -1.566927f, 2.119344f, 0.018893f, -1.604720f, 1.992744f, -0.235272f,
-    // f 88 85 108
-    -2.714429f, 1.706103f, -0.131958f, -2.739104f, 1.901744f, -0.230341f, -2.454129f, 1.839353f, -0.049119f,
-    // f 85 91 87
-    -2.739104f, 1.901744f, -0.230341f, -2.963567f, 1.763224f, -0.166606f, -2.747542f, 2.010613f, -0.158862f,
-    // f 84 65 78
-    -2.475875f, 0.842815f, -0.216794f, -1.967287f, 0.588401f, -0.233282f, -1.914636f, 0.426089f, 0.003811f,
-    // f 85 82 95
-    -2.739104f, 1.901744f, -0.230341f, -1.604720f, 1.992744f, -0.235272f, -1.691633f, 1.854672f, -0.021380f,
-    // f 57 76 77
-    2.502562f, 1.208656f, -0.410314f, 2.944266f, 2.031809f, -0.071125f, 2.629748f, 1.058343f, 0.045275f,
-    // f 45 95 82
-    -1.870902f, 1.281367f, -0.507106f, -1.691633f, 1.854672f, -0.021380f, -1.604720f, 1.992744f, -0.235272f,
-    // f 68 69 92
-    2.846714f, 2.050428f, -0.189403f, 2.890284f, 2.294064f, -0.168990f, 3.283993f, 2.305192f, -0.131355f,
-    // f 61 93 73
-    2.241828f, 1.336738f, -0.294247f, 2.180504f, 1.372668f, 0.152003f, 2.366578f, 1.602510f, -0.099890f,
-    // f 64 123 45
-    -2.007656f, 0.720078f, -0.130077f, -2.027009f, 0.742715f, 0.139439f, -1.870902f, 1.281367f, -0.507106f,
-    // f 89 94 71
-    0.387869f, 2.912241f, -0.035719f, 0.167637f, 2.610854f, 0.012210f, 0.010703f, 2.609281f, -0.169423f,
-    // f 45 123 95
-    -1.870902f, 1.281367f, -0.507106f, -2.027009f, 0.742715f, 0.139439f, -1.691633f, 1.854672f, -0.021380f,
-    // f 85 95 108
-    -2.739104f, 1.901744f, -0.230341f, -1.691633f, 1.854672f, -0.021380f, -2.454129f, 1.839353f, -0.049119f,
-    // f 91 86 109
-    -2.963567f, 1.763224f, -0.166606f, -2.800261f, 1.186742f, -0.216808f, -2.989165f, 1.433675f, 0.104924f,
-    // f 83 96 64
-    -2.603851f, 1.158914f, -0.190211f, -2.576953f, 1.257730f, -0.033285f, -2.007656f, 0.720078f, -0.130077f,
-    // f 82 90 42
-    -1.604720f, 1.992744f, -0.235272f, -1.566927f, 2.119344f, 0.018893f, -1.364717f, 2.355640f, -0.483351f,
-    // f 92 69 97
-    3.283993f, 2.305192f, -0.131355f, 2.890284f, 2.294064f, -0.168990f, 2.862305f, 2.289970f, -0.075370f,
-    // f 70 72 99
-    0.298779f, 2.969820f, -0.187167f, -0.326103f, 2.956401f, -0.216785f, -0.003298f, 2.999815f, -0.010441f,
-    // f 42 90 100
-    -1.364717f, 2.355640f, -0.483351f, -1.566927f, 2.119344f, 0.018893f, -1.423214f, 2.344353f, 0.327953f,
-    // f 50 48 94
-    0.298712f, 2.505079f, 0.099156f, 0.104173f, 2.509992f, -0.239106f, 0.167637f, 2.610854f, 0.012210f,
-    // f 48 71 94
-    0.104173f, 2.509992f, -0.239106f, 0.010703f, 2.609281f, -0.169423f, 0.167637f, 2.610854f, 0.012210f,
-    // f 43 58 52
-    1.279435f, 2.211809f, -0.566152f, 1.400451f, 2.216063f, 0.177075f, 1.417603f, 2.355075f, -0.111609f,
-    // f 70 99 101
-    0.298779f, 2.969820f, -0.187167f, -0.003298f, 2.999815f, -0.010441f, 0.010943f, 2.999699f, -0.002285f,
-    // f 49 67 58
-    1.234779f, 2.296869f, -0.356356f, 1.259740f, 2.321436f, 0.172469f, 1.400451f, 2.216063f, 0.177075f,
-    // f 68 92 102
-    2.846714f, 2.050428f, -0.189403f, 3.283993f, 2.305192f, -0.131355f, 3.451850f, 2.325150f, 0.009019f,
-    // f 61 59 93
-    2.241828f, 1.336738f, -0.294247f, 1.907254f, 1.276959f, -0.188708f, 2.180504f, 1.372668f, 0.152003f,
-    // f 92 97 104
-    3.283993f, 2.305192f, -0.131355f, 2.862305f, 2.289970f, -0.075370f, 2.857033f, 2.281524f, 0.067060f,
-    // f 74 73 105
-    2.632503f, 2.224633f, -0.070638f, 2.366578f, 1.602510f, -0.099890f, 2.568259f, 2.112296f, 0.090026f,
-    // f 70 101 98
-    0.298779f, 2.969820f, -0.187167f, 0.010943f, 2.999699f, -0.002285f, 0.182697f, 2.975476f, 0.295890f,
-    // f 83 88 96
-    -2.603851f, 1.158914f, -0.190211f, -2.714429f, 1.706103f, -0.131958f, -2.576953f, 1.257730f, -0.033285f,
-    // f 88 108 107
-    -2.714429f, 1.706103f, -0.131958f, -2.454129f, 1.839353f, -0.049119f, -2.741193f, 1.706926f, 0.164780f,
-    // f 90 87 113
-    -1.566927f, 2.119344f, 0.018893f, -2.747542f, 2.010613f, -0.158862f, -2.471991f, 2.077075f, 0.101498f,
-    // f 68 102 76
-    2.846714f, 2.050428f, -0.189403f, 3.451850f, 2.325150f, 0.009019f, 2.944266f, 2.031809f, -0.071125f,
-    // f 77 76 110
-    2.629748f, 1.058343f, 0.045275f, 2.944266f, 2.031809f, -0.071125f, 2.852049f, 1.910054f, 0.149962f,
-    // f 69 74 97
-    2.890284f, 2.294064f, -0.168990f, 2.632503f, 2.224633f, -0.070638f, 2.862305f, 2.289970f, -0.075370f,
-    // f 72 111 99
-    -0.326103f, 2.956401f, -0.216785f, -0.006988f, 2.997546f, 0.010408f, -0.003298f, 2.999815f, -0.010441f,
-    // f 72 75 106
-    -0.326103f, 2.956401f, -0.216785f, -0.167942f, 2.604722f, -0.008915f, -0.386151f, 2.912806f, 0.034518f,
-    // f 60 103 112
-    1.951454f, 0.540374f, -0.254847f, 2.295969f, 0.703965f, 0.280538f, 1.953479f, 0.545296f, 0.286884f,
-    // f 60 62 103
-    1.951454f, 0.540374f, -0.254847f, 2.335411f, 0.725993f, -0.263016f, 2.295969f, 0.703965f, 0.280538f,
-    // f 86 84 114
-    -2.800261f, 1.186742f, -0.216808f, -2.475875f, 0.842815f, -0.216794f, -2.720898f, 0.978282f, 0.096252f,
-    // f 84 78 114
-    -2.475875f, 0.842815f, -0.216794f, -1.914636f, 0.426089f, 0.003811f, -2.720898f, 0.978282f, 0.096252f,
-    // f 109 86 114
-    -2.989165f, 1.433675f, 0.104924f, -2.800261f, 1.186742f, -0.216808f, -2.720898f, 0.978282f, 0.096252f,
-    // f 87 91 134
-    -2.747542f, 2.010613f, -0.158862f, -2.963567f, 1.763224f, -0.166606f, -2.898107f, 1.852006f, 0.219955f,
-    // f 91 109 134
-    -2.963567f, 1.763224f, -0.166606f, -2.989165f, 1.433675f, 0.104924f, -2.898107f, 1.852006f, 0.219955f,
-    // f 92 115 102
-    3.283993f, 2.305192f, -0.131355f, 3.276603f, 2.303683f, 0.132102f, 3.451850f, 2.325150f, 0.009019f,
-    // f 104 115 92
-    2.857033f, 2.281524f, 0.067060f, 3.276603f, 2.303683f, 0.132102f, 3.283993f, 2.305192f, -0.131355f,
-    // f 97 74 104
-    2.862305f, 2.289970f, -0.075370f, 2.632503f, 2.224633f, -0.070638f, 2.857033f, 2.281524f, 0.067060f,
-    // f 73 93 125
-    2.366578f, 1.602510f, -0.099890f, 2.180504f, 1.372668f, 0.152003f, 2.324491f, 1.399524f, 0.280544f,
-    // f 21 117 116
-    -1.487463f, 0.002157f, -0.329736f, -1.102904f, 0.007102f, 1.035854f, -1.422906f, 0.009799f, 0.505996f,
-    // f 21 118 117
-    -1.487463f, 0.002157f, -0.329736f, -0.349921f, 0.007739f, 1.486198f, -1.102904f, 0.007102f, 1.035854f,
-    // f 21 119 118
-    -1.487463f, 0.002157f, -0.329736f, 0.428323f, 0.007444f, 1.443735f, -0.349921f, 0.007739f, 1.486198f,
-    // f 21 150 119
-    -1.487463f, 0.002157f, -0.329736f, 1.078241f, 0.008096f, 1.076544f, 0.428323f, 0.007444f, 1.443735f,
-    // f 21 55 150
-    -1.487463f, 0.002157f, -0.329736f, 1.528330f, 0.007339f, 0.129047f, 1.078241f, 0.008096f, 1.076544f,
-    // f 72 132 111
-    -0.326103f, 2.956401f, -0.216785f, -0.209225f, 2.953323f, 0.329289f, -0.006988f, 2.997546f, 0.010408f,
-    // f 47 42 129
-    -1.351349f, 2.284267f, -0.368191f, -1.364717f, 2.355640f, -0.483351f, -1.310895f, 2.250644f, 0.561339f,
-    // f 70 98 89
-    0.298779f, 2.969820f, -0.187167f, 0.182697f, 2.975476f, 0.295890f, 0.387869f, 2.912241f, -0.035719f,
-    // f 47 129 53
-    -1.351349f, 2.284267f, -0.368191f, -1.310895f, 2.250644f, 0.561339f, -1.396562f, 2.216265f, -0.016180f,
-    // f 64 96 122
-    -2.007656f, 0.720078f, -0.130077f, -2.576953f, 1.257730f, -0.033285f, -2.570657f, 1.161084f, 0.179958f,
-    // f 42 100 121
-    -1.364717f, 2.355640f, -0.483351f, -1.423214f, 2.344353f, 0.327953f, -1.316926f, 2.332119f, 0.462029f,
-    // f 58 67 139
-    1.400451f, 2.216063f, 0.177075f, 1.259740f, 2.321436f, 0.172469f, 1.255901f, 2.213735f, 0.479235f,
-    // f 60 112 56
-    1.951454f, 0.540374f, -0.254847f, 1.953479f, 0.545296f, 0.286884f, 1.825814f, 0.282648f, 0.042818f,
-    // f 93 59 81
-    2.180504f, 1.372668f, 0.152003f, 1.907254f, 1.276959f, -0.188708f, 1.919868f, 1.275235f, 0.187860f,
-    // f 62 77 103
-    2.335411f, 0.725993f, -0.263016f, 2.629748f, 1.058343f, 0.045275f, 2.295969f, 0.703965f, 0.280538f,
-    // f 101 111 98
-    0.010943f, 2.999699f, -0.002285f, -0.006988f, 2.997546f, 0.010408f, 0.182697f, 2.975476f, 0.295890f,
-    // f 111 132 98
-    -0.006988f, 2.997546f, 0.010408f, -0.209225f, 2.953323f, 0.329289f, 0.182697f, 2.975476f, 0.295890f,
-    // f 36 120 75
-    -0.273816f, 2.492922f, -0.205807f, -0.187042f, 2.493966f, 0.280281f, -0.167942f, 2.604722f, -0.008915f,
-    // f 76 115 110
-    2.944266f, 2.031809f, -0.071125f, 3.276603f, 2.303683f, 0.132102f, 2.852049f, 1.910054f, 0.149962f,
-    // f 94 89 124
-    0.167637f, 2.610854f, 0.012210f, 0.387869f, 2.912241f, -0.035719f, 0.307229f, 2.887259f, 0.214824f,
-    // f 113 87 134
-    -2.471991f, 2.077075f, 0.101498f, -2.747542f, 2.010613f, -0.158862f, -2.898107f, 1.852006f, 0.219955f,
-    // f 88 107 96
-    -2.714429f, 1.706103f, -0.131958f, -2.741193f, 1.706926f, 0.164780f, -2.576953f, 1.257730f, -0.033285f,
-    // f 64 122 123
-    -2.007656f, 0.720078f, -0.130077f, -2.570657f, 1.161084f, 0.179958f, -2.027009f, 0.742715f, 0.139439f,
-    // f 105 73 125
-    2.568259f, 2.112296f, 0.090026f, 2.366578f, 1.602510f, -0.099890f, 2.324491f, 1.399524f, 0.280544f,
-    // f 72 106 132
-    -0.326103f, 2.956401f, -0.216785f, -0.386151f, 2.912806f, 0.034518f, -0.209225f, 2.953323f, 0.329289f,
-    // f 36 80 120
-    -0.273816f, 2.492922f, -0.205807f, -1.255039f, 2.321482f, 0.264606f, -0.187042f, 2.493966f, 0.280281f,
-    // f 104 74 126
-    2.857033f, 2.281524f, 0.067060f, 2.632503f, 2.224633f, -0.070638f, 2.912056f, 2.294832f, 0.170956f,
-    // f 76 102 115
-    2.944266f, 2.031809f, -0.071125f, 3.451850f, 2.325150f, 0.009019f, 3.276603f, 2.303683f, 0.132102f,
-    // f 74 105 126
-    2.632503f, 2.224633f, -0.070638f, 2.568259f, 2.112296f, 0.090026f, 2.912056f, 2.294832f, 0.170956f,
-    // f 96 107 122
-    -2.576953f, 1.257730f, -0.033285f, -2.741193f, 1.706926f, 0.164780f, -2.570657f, 1.161084f, 0.179958f,
-    // f 108 128 107
-    -2.454129f, 1.839353f, -0.049119f, -2.489030f, 1.945967f, 0.241249f, -2.741193f, 1.706926f, 0.164780f,
-    // f 75 120 127
-    -0.167942f, 2.604722f, -0.008915f, -0.187042f, 2.493966f, 0.280281f, -0.005848f, 2.605097f, 0.169025f,
-    // f 75 127 106
-    -0.167942f, 2.604722f, -0.008915f, -0.005848f, 2.605097f, 0.169025f, -0.386151f, 2.912806f, 0.034518f,
-    // f 121 129 42
-    -1.316926f, 2.332119f, 0.462029f, -1.310895f, 2.250644f, 0.561339f, -1.364717f, 2.355640f, -0.483351f,
-    // f 89 98 124
-    0.387869f, 2.912241f, -0.035719f, 0.182697f, 2.975476f, 0.295890f, 0.307229f, 2.887259f, 0.214824f,
-    // f 104 126 115
-    2.857033f, 2.281524f, 0.067060f, 2.912056f, 2.294832f, 0.170956f, 3.276603f, 2.303683f, 0.132102f,
-    // f 52 141 81
-    1.417603f, 2.355075f, -0.111609f, 1.324332f, 2.360105f, 0.525745f, 1.919868f, 1.275235f, 0.187860f,
-    // f 95 128 108
-    -1.691633f, 1.854672f, -0.021380f, -2.489030f, 1.945967f, 0.241249f, -2.454129f, 1.839353f, -0.049119f,
-    // f 109 114 131
-    -2.989165f, 1.433675f, 0.104924f, -2.720898f, 0.978282f, 0.096252f, -2.609073f, 0.983400f, 0.225695f,
-    // f 21 116 79
-    -1.487463f, 0.002157f, -0.329736f, -1.422906f, 0.009799f, 0.505996f, -1.820856f, 0.297554f, 0.207656f,
-    // f 94 124 127
-    0.167637f, 2.610854f, 0.012210f, 0.307229f, 2.887259f, 0.214824f, -0.005848f, 2.605097f, 0.169025f,
-    // f 127 132 106
-    -0.005848f, 2.605097f, 0.169025f, -0.209225f, 2.953323f, 0.329289f, -0.386151f, 2.912806f, 0.034518f,
-    // f 95 133 136
-    -1.691633f, 1.854672f, -0.021380f, -1.769395f, 1.503428f, 0.537547f, -1.615370f, 1.971117f, 0.230304f,
-    // f 105 125 137
-    2.568259f, 2.112296f, 0.090026f, 2.324491f, 1.399524f, 0.280544f, 2.403092f, 1.146000f, 0.446345f,
-    // f 95 123 133
-    -1.691633f, 1.854672f, -0.021380f, -2.027009f, 0.742715f, 0.139439f, -1.769395f, 1.503428f, 0.537547f,
-    // f 128 95 136
-    -2.489030f, 1.945967f, 0.241249f, -1.691633f, 1.854672f, -0.021380f, -1.615370f, 1.971117f, 0.230304f,
-    // f 122 107 134
-    -2.570657f, 1.161084f, 0.179958f, -2.741193f, 1.706926f, 0.164780f, -2.898107f, 1.852006f, 0.219955f,
-    // f 90 113 128
-    -1.566927f, 2.119344f, 0.018893f, -2.471991f, 2.077075f, 0.101498f, -2.489030f, 1.945967f, 0.241249f,
-    // f 113 134 128
-    -2.471991f, 2.077075f, 0.101498f, -2.898107f, 1.852006f, 0.219955f, -2.489030f, 1.945967f, 0.241249f,
-    // f 114 78 131
-    -2.720898f, 0.978282f, 0.096252f, -1.914636f, 0.426089f, 0.003811f, -2.609073f, 0.983400f, 0.225695f,
-    // f 78 130 131
-    -1.914636f, 0.426089f, 0.003811f, -1.969118f, 0.589108f, 0.239657f, -2.609073f, 0.983400f, 0.225695f,
-    // f 110 115 126
-    2.852049f, 1.910054f, 0.149962f, 3.276603f, 2.303683f, 0.132102f, 2.912056f, 2.294832f, 0.170956f,
-    // f 78 135 130
-    -1.914636f, 0.426089f, 0.003811f, -1.915484f, 0.667153f, 0.664829f, -1.969118f, 0.589108f, 0.239657f,
-    // f 105 137 126
-    2.568259f, 2.112296f, 0.090026f, 2.403092f, 1.146000f, 0.446345f, 2.912056f, 2.294832f, 0.170956f,
-    // f 94 127 120
-    0.167637f, 2.610854f, 0.012210f, -0.005848f, 2.605097f, 0.169025f, -0.187042f, 2.493966f, 0.280281f,
-    // f 94 120 50
-    0.167637f, 2.610854f, 0.012210f, -0.187042f, 2.493966f, 0.280281f, 0.298712f, 2.505079f, 0.099156f,
-    // f 90 128 136
-    -1.566927f, 2.119344f, 0.018893f, -2.489030f, 1.945967f, 0.241249f, -1.615370f, 1.971117f, 0.230304f,
-    // f 122 134 131
-    -2.570657f, 1.161084f, 0.179958f, -2.898107f, 1.852006f, 0.219955f, -2.609073f, 0.983400f, 0.225695f,
-    // f 90 136 100
-    -1.566927f, 2.119344f, 0.018893f, -1.615370f, 1.971117f, 0.230304f, -1.423214f, 2.344353f, 0.327953f,
-    // f 77 110 137
-    2.629748f, 1.058343f, 0.045275f, 2.852049f, 1.910054f, 0.149962f, 2.403092f, 1.146000f, 0.446345f,
-    // f 130 123 131
-    -1.969118f, 0.589108f, 0.239657f, -2.027009f, 0.742715f, 0.139439f, -2.609073f, 0.983400f, 0.225695f,
-    // f 123 122 131
-    -2.027009f, 0.742715f, 0.139439f, -2.570657f, 1.161084f, 0.179958f, -2.609073f, 0.983400f, 0.225695f,
-    // f 109 131 134
-    -2.989165f, 1.433675f, 0.104924f, -2.609073f, 0.983400f, 0.225695f, -2.898107f, 1.852006f, 0.219955f,
-    // f 127 124 138
-    -0.005848f, 2.605097f, 0.169025f, 0.307229f, 2.887259f, 0.214824f, 0.035719f, 2.912241f, 0.387870f,
-    // f 107 128 134
-    -2.741193f, 1.706926f, 0.164780f, -2.489030f, 1.945967f, 0.241249f, -2.898107f, 1.852006f, 0.219955f,
-    // f 136 133 100
-    -1.615370f, 1.971117f, 0.230304f, -1.769395f, 1.503428f, 0.537547f, -1.423214f, 2.344353f, 0.327953f,
-    // f 80 53 140
-    -1.255039f, 2.321482f, 0.264606f, -1.396562f, 2.216265f, -0.016180f, -1.121214f, 2.216969f, 0.755930f,
-    // f 132 127 138
-    -0.209225f, 2.953323f, 0.329289f, -0.005848f, 2.605097f, 0.169025f, 0.035719f, 2.912241f, 0.387870f,
-    // f 52 58 141
-    1.417603f, 2.355075f, -0.111609f, 1.400451f, 2.216063f, 0.177075f, 1.324332f, 2.360105f, 0.525745f,
-    // f 78 79 135
-    -1.914636f, 0.426089f, 0.003811f, -1.820856f, 0.297554f, 0.207656f, -1.915484f, 0.667153f, 0.664829f,
-    // f 77 137 103
-    2.629748f, 1.058343f, 0.045275f, 2.403092f, 1.146000f, 0.446345f, 2.295969f, 0.703965f, 0.280538f,
-    // f 93 81 125
-    2.180504f, 1.372668f, 0.152003f, 1.919868f, 1.275235f, 0.187860f, 2.324491f, 1.399524f, 0.280544f,
-    // f 132 138 98
-    -0.209225f, 2.953323f, 0.329289f, 0.035719f, 2.912241f, 0.387870f, 0.182697f, 2.975476f, 0.295890f,
-    // f 98 138 124
-    0.182697f, 2.975476f, 0.295890f, 0.035719f, 2.912241f, 0.387870f, 0.307229f, 2.887259f, 0.214824f,
-    // f 110 126 137
-    2.852049f, 1.910054f, 0.149962f, 2.912056f, 2.294832f, 0.170956f, 2.403092f, 1.146000f, 0.446345f,
-    // f 141 142 81
-    1.324332f, 2.360105f, 0.525745f, 1.661329f, 1.504959f, 0.812314f, 1.919868f, 1.275235f, 0.187860f,
-    // f 125 81 145
-    2.324491f, 1.399524f, 0.280544f, 1.919868f, 1.275235f, 0.187860f, 1.932341f, 0.907251f, 0.521333f,
-    // f 53 129 140
-    -1.396562f, 2.216265f, -0.016180f, -1.310895f, 2.250644f, 0.561339f, -1.121214f, 2.216969f, 0.755930f,
-    // f 50 143 67
-    0.298712f, 2.505079f, 0.099156f, 0.810504f, 2.323339f, 0.987484f, 1.259740f, 2.321436f, 0.172469f,
-    // f 120 80 144
-    -0.187042f, 2.493966f, 0.280281f, -1.255039f, 2.321482f, 0.264606f, -0.526860f, 2.316559f, 1.163692f,
-    // f 103 137 145
-    2.295969f, 0.703965f, 0.280538f, 2.403092f, 1.146000f, 0.446345f, 1.932341f, 0.907251f, 0.521333f,
-    // f 125 145 137
-    2.324491f, 1.399524f, 0.280544f, 1.932341f, 0.907251f, 0.521333f, 2.403092f, 1.146000f, 0.446345f,
-    // f 103 145 112
-    2.295969f, 0.703965f, 0.280538f, 1.932341f, 0.907251f, 0.521333f, 1.953479f, 0.545296f, 0.286884f,
-    // f 81 142 145
-    1.919868f, 1.275235f, 0.187860f, 1.661329f, 1.504959f, 0.812314f, 1.932341f, 0.907251f, 0.521333f,
-    // f 130 135 123
-    -1.969118f, 0.589108f, 0.239657f, -1.915484f, 0.667153f, 0.664829f, -2.027009f, 0.742715f, 0.139439f,
-    // f 56 146 55
-    1.825814f, 0.282648f, 0.042818f, 1.636637f, 0.356250f, 0.936216f, 1.528330f, 0.007339f, 0.129047f,
-    // f 139 147 58
-    1.255901f, 2.213735f, 0.479235f, 1.094740f, 2.309321f, 0.869699f, 1.400451f, 2.216063f, 0.177075f,
-    // f 58 147 141
-    1.400451f, 2.216063f, 0.177075f, 1.094740f, 2.309321f, 0.869699f, 1.324332f, 2.360105f, 0.525745f,
-    // f 56 112 146
-    1.825814f, 0.282648f, 0.042818f, 1.953479f, 0.545296f, 0.286884f, 1.636637f, 0.356250f, 0.936216f,
-    // f 116 148 79
-    -1.422906f, 0.009799f, 0.505996f, -1.549466f, 0.372489f, 1.094935f, -1.820856f, 0.297554f, 0.207656f,
-    // f 123 135 133
-    -2.027009f, 0.742715f, 0.139439f, -1.915484f, 0.667153f, 0.664829f, -1.769395f, 1.503428f, 0.537547f,
-    // f 139 143 149
-    1.255901f, 2.213735f, 0.479235f, 0.810504f, 2.323339f, 0.987484f, 0.832083f, 2.212443f, 1.116323f,
-    // f 79 148 135
-    -1.820856f, 0.297554f, 0.207656f, -1.549466f, 0.372489f, 1.094935f, -1.915484f, 0.667153f, 0.664829f,
-    // f 50 120 143
-    0.298712f, 2.505079f, 0.099156f, -0.187042f, 2.493966f, 0.280281f, 0.810504f, 2.323339f, 0.987484f,
-    // f 139 149 147
-    1.255901f, 2.213735f, 0.479235f, 0.832083f, 2.212443f, 1.116323f, 1.094740f, 2.309321f, 0.869699f,
-    // f 120 144 143
-    -0.187042f, 2.493966f, 0.280281f, -0.526860f, 2.316559f, 1.163692f, 0.810504f, 2.323339f, 0.987484f,
-    // f 112 152 146
-    1.953479f, 0.545296f, 0.286884f, 1.778903f, 0.775805f, 0.954697f, 1.636637f, 0.356250f, 0.936216f,
-    // f 112 145 152
-    1.953479f, 0.545296f, 0.286884f, 1.932341f, 0.907251f, 0.521333f, 1.778903f, 0.775805f, 0.954697f,
-    // f 55 146 150
-    1.528330f, 0.007339f, 0.129047f, 1.636637f, 0.356250f, 0.936216f, 1.078241f, 0.008096f, 1.076544f,
-    // f 67 143 139
-    1.259740f, 2.321436f, 0.172469f, 0.810504f, 2.323339f, 0.987484f, 1.255901f, 2.213735f, 0.479235f,
-    // f 116 117 148
-    -1.422906f, 0.009799f, 0.505996f, -1.102904f, 0.007102f, 1.035854f, -1.549466f, 0.372489f, 1.094935f,
-    // f 100 133 151
-    -1.423214f, 2.344353f, 0.327953f, -1.769395f, 1.503428f, 0.537547f, -1.420294f, 1.460846f, 1.216232f,
-    // f 100 151 153
-    -1.423214f, 2.344353f, 0.327953f, -1.420294f, 1.460846f, 1.216232f, -0.971553f, 2.362864f, 1.041688f,
-    // f 141 158 142
-    1.324332f, 2.360105f, 0.525745f, 1.000246f, 2.326636f, 1.082173f, 1.661329f, 1.504959f, 0.812314f,
-    // f 142 152 145
-    1.661329f, 1.504959f, 0.812314f, 1.778903f, 0.775805f, 0.954697f, 1.932341f, 0.907251f, 0.521333f,
-    // f 140 129 155
-    -1.121214f, 2.216969f, 0.755930f, -1.310895f, 2.250644f, 0.561339f, -0.678084f, 2.205180f, 1.223172f,
-    // f 121 153 129
-    -1.316926f, 2.332119f, 0.462029f, -0.971553f, 2.362864f, 1.041688f, -1.310895f, 2.250644f, 0.561339f,
-    // f 121 100 153
-    -1.316926f, 2.332119f, 0.462029f, -1.423214f, 2.344353f, 0.327953f, -0.971553f, 2.362864f, 1.041688f,
-    // f 80 140 144
-    -1.255039f, 2.321482f, 0.264606f, -1.121214f, 2.216969f, 0.755930f, -0.526860f, 2.316559f, 1.163692f,
-    // f 133 135 151
-    -1.769395f, 1.503428f, 0.537547f, -1.915484f, 0.667153f, 0.664829f, -1.420294f, 1.460846f, 1.216232f,
-    // f 158 156 142
-    1.000246f, 2.326636f, 1.082173f, 1.370488f, 1.130480f, 1.427473f, 1.661329f, 1.504959f, 0.812314f,
-    // f 135 148 154
-    -1.915484f, 0.667153f, 0.664829f, -1.549466f, 0.372489f, 1.094935f, -1.603169f, 0.754075f, 1.236181f,
-    // f 135 154 151
-    -1.915484f, 0.667153f, 0.664829f, -1.603169f, 0.754075f, 1.236181f, -1.420294f, 1.460846f, 1.216232f,
-    // f 153 155 129
-    -0.971553f, 2.362864f, 1.041688f, -0.678084f, 2.205180f, 1.223172f, -1.310895f, 2.250644f, 0.561339f,
-    // f 117 157 148
-    -1.102904f, 0.007102f, 1.035854f, -1.167260f, 0.340125f, 1.460785f, -1.549466f, 0.372489f, 1.094935f,
-    // f 147 163 141
-    1.094740f, 2.309321f, 0.869699f, 0.476434f, 2.341109f, 1.314991f, 1.324332f, 2.360105f, 0.525745f,
-    // f 141 163 158
-    1.324332f, 2.360105f, 0.525745f, 0.476434f, 2.341109f, 1.314991f, 1.000246f, 2.326636f, 1.082173f,
-    // f 152 159 146
-    1.778903f, 0.775805f, 0.954697f, 1.405877f, 0.604062f, 1.431150f, 1.636637f, 0.356250f, 0.936216f,
-    // f 143 144 160
-    0.810504f, 2.323339f, 0.987484f, -0.526860f, 2.316559f, 1.163692f, 0.313347f, 2.290642f, 1.274382f,
-    // f 142 156 152
-    1.661329f, 1.504959f, 0.812314f, 1.370488f, 1.130480f, 1.427473f, 1.778903f, 0.775805f, 0.954697f,
-    // f 146 161 150
-    1.636637f, 0.356250f, 0.936216f, 0.994809f, 0.301343f, 1.560239f, 1.078241f, 0.008096f, 1.076544f,
-    // f 143 160 149
-    0.810504f, 2.323339f, 0.987484f, 0.313347f, 2.290642f, 1.274382f, 0.832083f, 2.212443f, 1.116323f,
-    // f 140 155 144
-    -1.121214f, 2.216969f, 0.755930f, -0.678084f, 2.205180f, 1.223172f, -0.526860f, 2.316559f, 1.163692f,
-    // f 158 162 156
-    1.000246f, 2.326636f, 1.082173f, 0.894052f, 1.505337f, 1.618855f, 1.370488f, 1.130480f, 1.427473f,
-    // f 153 164 155
-    -0.971553f, 2.362864f, 1.041688f, -0.368191f, 2.284267f, 1.351349f, -0.678084f, 2.205180f, 1.223172f,
-    // f 147 149 163
-    1.094740f, 2.309321f, 0.869699f, 0.832083f, 2.212443f, 1.116323f, 0.476434f, 2.341109f, 1.314991f,
-    // f 152 156 159
-    1.778903f, 0.775805f, 0.954697f, 1.370488f, 1.130480f, 1.427473f, 1.405877f, 0.604062f, 1.431150f,
-    // f 153 151 165
-    -0.971553f, 2.362864f, 1.041688f, -1.420294f, 1.460846f, 1.216232f, -0.812314f, 1.504958f, 1.661329f,
-    // f 164 153 166
-    -0.368191f, 2.284267f, 1.351349f, -0.971553f, 2.362864f, 1.041688f, -0.413938f, 2.356096f, 1.370203f,
-    // f 149 167 163
-    0.832083f, 2.212443f, 1.116323f, 0.348165f, 2.221583f, 1.350116f, 0.476434f, 2.341109f, 1.314991f,
-    // f 163 168 158
-    0.476434f, 2.341109f, 1.314991f, 0.244050f, 2.339592f, 1.445908f, 1.000246f, 2.326636f, 1.082173f,
-    // f 160 167 149
-    0.313347f, 2.290642f, 1.274382f, 0.348165f, 2.221583f, 1.350116f, 0.832083f, 2.212443f, 1.116323f,
-    // f 144 155 160
-    -0.526860f, 2.316559f, 1.163692f, -0.678084f, 2.205180f, 1.223172f, 0.313347f, 2.290642f, 1.274382f,
-    // f 160 155 167
-    0.313347f, 2.290642f, 1.274382f, -0.678084f, 2.205180f, 1.223172f, 0.348165f, 2.221583f, 1.350116f,
-    // f 153 165 166
-    -0.971553f, 2.362864f, 1.041688f, -0.812314f, 1.504958f, 1.661329f, -0.413938f, 2.356096f, 1.370203f,
-    // f 158 168 162
-    1.000246f, 2.326636f, 1.082173f, 0.244050f, 2.339592f, 1.445908f, 0.894052f, 1.505337f, 1.618855f,
-    // f 146 159 161
-    1.636637f, 0.356250f, 0.936216f, 1.405877f, 0.604062f, 1.431150f, 0.994809f, 0.301343f, 1.560239f,
-    // f 117 118 157
-    -1.102904f, 0.007102f, 1.035854f, -0.349921f, 0.007739f, 1.486198f, -1.167260f, 0.340125f, 1.460785f,
-    // f 150 161 119
-    1.078241f, 0.008096f, 1.076544f, 0.994809f, 0.301343f, 1.560239f, 0.428323f, 0.007444f, 1.443735f,
-    // f 118 169 157
-    -0.349921f, 0.007739f, 1.486198f, -0.567257f, 0.355446f, 1.796084f, -1.167260f, 0.340125f, 1.460785f,
-    // f 167 166 163
-    0.348165f, 2.221583f, 1.350116f, -0.413938f, 2.356096f, 1.370203f, 0.476434f, 2.341109f, 1.314991f,
-    // f 167 155 164
-    0.348165f, 2.221583f, 1.350116f, -0.678084f, 2.205180f, 1.223172f, -0.368191f, 2.284267f, 1.351349f,
-    // f 163 166 168
-    0.476434f, 2.341109f, 1.314991f, -0.413938f, 2.356096f, 1.370203f, 0.244050f, 2.339592f, 1.445908f,
-    // f 166 167 164
-    -0.413938f, 2.356096f, 1.370203f, 0.348165f, 2.221583f, 1.350116f, -0.368191f, 2.284267f, 1.351349f,
-    // f 154 171 151
-    -1.603169f, 0.754075f, 1.236181f, -1.060833f, 0.798496f, 1.721296f, -1.420294f, 1.460846f, 1.216232f,
-    // f 168 170 162
-    0.244050f, 2.339592f, 1.445908f, 0.069387f, 1.397063f, 1.903138f, 0.894052f, 1.505337f, 1.618855f,
-    // f 148 171 154
-    -1.549466f, 0.372489f, 1.094935f, -1.060833f, 0.798496f, 1.721296f, -1.603169f, 0.754075f, 1.236181f,
-    // f 148 157 171
-    -1.549466f, 0.372489f, 1.094935f, -1.167260f, 0.340125f, 1.460785f, -1.060833f, 0.798496f, 1.721296f,
-    // f 166 165 170
-    -0.413938f, 2.356096f, 1.370203f, -0.812314f, 1.504958f, 1.661329f, 0.069387f, 1.397063f, 1.903138f,
-    // f 166 170 168
-    -0.413938f, 2.356096f, 1.370203f, 0.069387f, 1.397063f, 1.903138f, 0.244050f, 2.339592f, 1.445908f,
-    // f 151 171 165
-    -1.420294f, 1.460846f, 1.216232f, -1.060833f, 0.798496f, 1.721296f, -0.812314f, 1.504958f, 1.661329f,
-    // f 119 161 172
-    0.428323f, 0.007444f, 1.443735f, 0.994809f, 0.301343f, 1.560239f, 0.081776f, 0.438938f, 1.949718f,
-    // f 162 173 156
-    0.894052f, 1.505337f, 1.618855f, 0.733810f, 0.700094f, 1.897039f, 1.370488f, 1.130480f, 1.427473f,
-    // f 156 173 159
-    1.370488f, 1.130480f, 1.427473f, 0.733810f, 0.700094f, 1.897039f, 1.405877f, 0.604062f, 1.431150f,
-    // f 119 172 118
-    0.428323f, 0.007444f, 1.443735f, 0.081776f, 0.438938f, 1.949718f, -0.349921f, 0.007739f, 1.486198f,
-    // f 118 172 169
-    -0.349921f, 0.007739f, 1.486198f, 0.081776f, 0.438938f, 1.949718f, -0.567257f, 0.355446f, 1.796084f,
-    // f 159 173 161
-    1.405877f, 0.604062f, 1.431150f, 0.733810f, 0.700094f, 1.897039f, 0.994809f, 0.301343f, 1.560239f,
-    // f 157 174 171
-    -1.167260f, 0.340125f, 1.460785f, -0.377047f, 0.751855f, 1.999724f, -1.060833f, 0.798496f, 1.721296f,
-    // f 157 169 174
-    -1.167260f, 0.340125f, 1.460785f, -0.567257f, 0.355446f, 1.796084f, -0.377047f, 0.751855f, 1.999724f,
-    // f 162 170 173
-    0.894052f, 1.505337f, 1.618855f, 0.069387f, 1.397063f, 1.903138f, 0.733810f, 0.700094f, 1.897039f,
-    // f 165 171 174
-    -0.812314f, 1.504958f, 1.661329f, -1.060833f, 0.798496f, 1.721296f, -0.377047f, 0.751855f, 1.999724f,
-    // f 161 173 172
-    0.994809f, 0.301343f, 1.560239f, 0.733810f, 0.700094f, 1.897039f, 0.081776f, 0.438938f, 1.949718f,
-    // f 165 174 170
-    -0.812314f, 1.504958f, 1.661329f, -0.377047f, 0.751855f, 1.999724f, 0.069387f, 1.397063f, 1.903138f,
-    // f 169 172 174
-    -0.567257f, 0.355446f, 1.796084f, 0.081776f, 0.438938f, 1.949718f, -0.377047f, 0.751855f, 1.999724f,
-    // f 170 174 173
-    0.069387f, 1.397063f, 1.903138f, -0.377047f, 0.751855f, 1.999724f, 0.733810f, 0.700094f, 1.897039f,
-    // f 174 172 173
-    -0.377047f, 0.751855f, 1.999724f, 0.081776f, 0.438938f, 1.949718f, 0.733810f, 0.700094f, 1.897039f,
+// Data derived from teapot.obj
+// Centered on the bounding box center (0.222000, 1.500000, 0.000000) of the input
+// Crease edges bend more than 45.0 degrees
+// 2 levels of detail with 346, 120 triangles, finest first, each decimated from the one before
+
+// Level 0
+#define TEAPOT_DECIMATED_VERTEX_COUNT 204
+#define TEAPOT_DECIMATED_TRIANGLE_COUNT 346
+#define TEAPOT_DECIMATED_EDGE_COUNT 550
+#define TEAPOT_DECIMATED_CLUSTER_COUNT 20
+
+// Unique teapot vertices
+// Each vertex is 3 int16 (x, y, z), model position is
+// vertex * teapot_decimated_mesh.vertex_scale
+static const int16_t teapot_decimated_vertices[] = {
+    -420, 8800, 14574,
+    -2254, 7577, 14304,
+    2376, 7603, 13689,
+    7253, 7529, 12562,
+    3004, 8771, 13890,
+    6313, 7603, 11661,
+    9836, 8793, 8472,
+    9405, 7603, 8569,
+    12693, 7586, 4820,
+    12296, 8765, 2097,
+    11436, 7604, 4633,
+    12049, 7577, -1,
+    12350, 8375, -4200,
+    -16859, 8375, 4200,
+    -16558, 7577, 1,
+    -15944, 7603, 4631,
+    -14389, 8743, 8661,
+    -13915, 7603, 8568,
+    -10727, 8793, 12091,
+    -10824, 7603, 11660,
+    -6265, 8740, 14387,
+    -6888, 7604, 13691,
+    -4154, 8798, -14562,
+    -2256, 7577, -14304,
+    -6886, 7603, -13689,
+    -11763, 7529, -12562,
+    -7513, 8771, -13890,
+    -10823, 7603, -11661,
+    -14345, 8793, -8472,
+    -13915, 7603, -8569,
+    -16685, 8785, -3772,
+    -15946, 7604, -4633,
+    11434, 7603, -4631,
+    9879, 8743, -8661,
+    9406, 7603, -8568,
+    6217, 8793, -12091,
+    6314, 7603, -11660,
+    1620, 8734, -14442,
+    2378, 7604, -13691,
+    -63, -4457, 20201,
+    -4490, -3599, 19978,
+    -2118, 2656, 17776,
+    4273, -4269, 19474,
+    3547, 2285, 17149,
+    9875, -4246, 16600,
+    14233, -10329, 12102,
+    14223, -3842, 12090,
+    12352, 2285, 10733,
+    17108, -10309, 6535,
+    17078, -3796, 6517,
+    17962, -3830, 66,
+    15521, 2656, -137,
+    -22232, -3599, -2235,
+    -21766, -1924, 2044,
+    -19591, 2868, -4601,
+    -21789, -9274, 6608,
+    -21469, -3005, 6450,
+    -18730, -10328, 12120,
+    -18617, -2944, 11971,
+    -14480, -9263, 16641,
+    -14345, -3842, 16477,
+    -12988, 2285, 14606,
+    -8790, -10309, 19363,
+    -8772, -2885, 19153,
+    -2566, -9342, 20402,
+    -2188, -3830, -20217,
+    -2392, 2656, -17776,
+    -8805, -10348, -19340,
+    -8705, -3005, -19214,
+    -14385, -4246, -16600,
+    -18896, -9263, -12225,
+    -18732, -3842, -12090,
+    -16861, 2285, -10733,
+    -22072, -9281, -5883,
+    -21588, -3796, -6517,
+    17085, -10348, -6550,
+    16959, -3005, -6450,
+    14220, -10328, -12120,
+    14108, -2944, -11971,
+    9847, -10329, -16488,
+    9836, -3842, -16477,
+    8478, 2285, -14606,
+    4280, -10309, -19363,
+    4263, -2885, -19153,
+    -2351, -15235, 15166,
+    -2346, -11979, 18882,
+    4212, -10653, 19124,
+    4940, -15235, 13687,
+    9723, -10627, 16298,
+    11292, -15235, 7453,
+    12912, -15235, 96,
+    16627, -11979, 91,
+    18173, -9271, 6,
+    -17355, -15235, 3163,
+    -20673, -12124, -4868,
+    -22756, -8514, 2048,
+    -20589, -11981, 5380,
+    -14608, -15235, 9078,
+    -9708, -15235, 13547,
+    -13565, -11942, 15411,
+    -2159, -15235, -15166,
+    -2164, -11979, -18882,
+    -2248, -9271, -20428,
+    -9450, -15235, -13687,
+    -14233, -10627, -16298,
+    -17666, -11942, -11310,
+    -15877, -15235, -7347,
+    11432, -15235, -7195,
+    5199, -15235, -13547,
+    -32408, 3663, 1437,
+    -29487, 5539, 1387,
+    -17512, 6147, 1412,
+    -27672, 4823, 2467,
+    -31474, 2476, 2409,
+    -18463, 3884, 1488,
+    -28012, 3540, 1064,
+    -29732, 2676, -1258,
+    -18459, 4077, -1324,
+    -31750, 3417, -2438,
+    -17996, 4957, -2677,
+    -28253, 4772, -2468,
+    -29564, 5511, -1596,
+    -17547, 5959, -1472,
+    -21535, -10774, 11,
+    -29078, -6242, 1368,
+    -32418, -1371, -1394,
+    -32262, -1054, 2049,
+    -21648, -10424, 1632,
+    -26586, -6802, 2433,
+    -22480, -7825, 1645,
+    -26685, -5173, 1177,
+    -29913, 634, 1395,
+    -22544, -7769, -1401,
+    -28120, -4094, -1898,
+    -30812, -1448, -2471,
+    -28672, -6234, -1999,
+    -21686, -10394, -1775,
+    27279, 5198, 997,
+    24236, -4744, 1315,
+    19435, -9232, -2776,
+    15014, -10770, 1424,
+    28557, 7616, 1943,
+    23008, -4824, 3849,
+    20710, -8678, 2628,
+    15015, -8975, 4428,
+    25634, 4662, 2252,
+    18885, -6536, 5017,
+    15011, -5613, 5126,
+    24933, 7539, 1277,
+    21894, -3064, 4401,
+    20905, -1558, 2979,
+    19259, -1733, 1592,
+    15013, -2547, 2694,
+    23871, 6265, -1305,
+    15018, -2958, -2897,
+    21348, -486, -2419,
+    22521, -2620, -4322,
+    26520, 4249, -1960,
+    20151, -5981, -4910,
+    15009, -6471, -5408,
+    29692, 7619, -1835,
+    23567, -5536, -2727,
+    15018, -10136, -3079,
+    32287, 8440, 1242,
+    26306, 7548, 465,
+    28547, 7642, 1309,
+    27377, 7645, -1155,
+    26199, 8038, -1052,
+    32767, 8463, -1029,
+    30172, 8021, -98,
+    -2644, 11356, 1576,
+    -3322, 14770, 4082,
+    -81, 14393, 3481,
+    -665, 11311, 510,
+    1827, 14770, 1067,
+    -6337, 14770, -1067,
+    -5736, 14393, 2174,
+    -1187, 14770, -4082,
+    -4428, 14393, -3481,
+    -3626, 10971, -713,
+    -2255, 15252, 0,
+    1226, 14393, -2174,
+    -1500, 10932, -1140,
+    729, 7618, 13491,
+    -2041, 8426, 12620,
+    34, 10054, 2333,
+    8914, 7618, 8139,
+    5379, 8436, 10464,
+    11237, 7618, -2983,
+    1425, 9857, -2256,
+    10383, 8437, 2789,
+    -15746, 7618, 2983,
+    -4603, 10046, 2333,
+    -14516, 8368, 4423,
+    -10394, 7618, 11169,
+    -9509, 8441, 10713,
+    -5238, 7618, -13491,
+    534, 8437, -12638,
+    -4510, 9857, -3680,
+    -13424, 7618, -8139,
+    -9889, 8436, -10464,
+    -14396, 8508, -3581,
+    5884, 7618, -11169,
+    8209, 8436, -7634,
+};
+
+// Teapot triangles as indices into teapot_decimated_vertices
+// Each triangle is 3 indices
+static const uint16_t teapot_decimated_indices[] = {
+    3, 6, 4,
+    42, 44, 43,
+    3, 43, 44,
+    43, 3, 4,
+    46, 44, 45,
+    44, 46, 3,
+    47, 3, 46,
+    6, 3, 47,
+    45, 48, 46,
+    49, 46, 48,
+    46, 49, 47,
+    8, 47, 49,
+    47, 8, 6,
+    86, 88, 42,
+    44, 42, 88,
+    88, 45, 44,
+    9, 6, 8,
+    48, 92, 49,
+    50, 49, 92,
+    49, 50, 8,
+    51, 8, 50,
+    9, 8, 51,
+    12, 9, 51,
+    92, 75, 50,
+    76, 50, 75,
+    50, 76, 51,
+    51, 76, 12,
+    76, 78, 12,
+    33, 12, 78,
+    4, 6, 5,
+    7, 5, 6,
+    6, 9, 7,
+    10, 7, 9,
+    11, 10, 9,
+    16, 30, 13,
+    30, 16, 14,
+    15, 14, 16,
+    26, 28, 27,
+    29, 27, 28,
+    28, 30, 29,
+    31, 29, 30,
+    14, 31, 30,
+    33, 9, 12,
+    9, 33, 11,
+    32, 11, 33,
+    110, 121, 109,
+    113, 109, 126,
+    109, 113, 110,
+    112, 110, 113,
+    110, 112, 111,
+    114, 111, 112,
+    115, 113, 131,
+    113, 115, 112,
+    112, 115, 114,
+    131, 116, 115,
+    115, 117, 114,
+    115, 116, 117,
+    120, 116, 118,
+    116, 120, 117,
+    119, 117, 120,
+    121, 120, 118,
+    122, 120, 121,
+    120, 122, 119,
+    121, 111, 122,
+    125, 126, 118,
+    109, 118, 126,
+    118, 109, 121,
+    121, 110, 111,
+    126, 125, 124,
+    123, 127, 124,
+    127, 128, 124,
+    126, 124, 128,
+    127, 129, 128,
+    113, 126, 128,
+    129, 130, 128,
+    128, 130, 113,
+    131, 113, 130,
+    129, 132, 130,
+    130, 133, 131,
+    131, 133, 116,
+    133, 130, 132,
+    133, 134, 116,
+    118, 116, 134,
+    132, 136, 133,
+    135, 133, 136,
+    133, 135, 134,
+    125, 134, 135,
+    134, 125, 118,
+    136, 123, 135,
+    124, 135, 123,
+    135, 124, 125,
+    148, 145, 141,
+    145, 148, 149,
+    146, 149, 147,
+    150, 149, 148,
+    149, 150, 147,
+    152, 147, 150,
+    157, 161, 156,
+    156, 161, 158,
+    139, 158, 161,
+    158, 139, 159,
+    162, 159, 139,
+    163, 168, 169,
+    169, 165, 163,
+    148, 163, 165,
+    163, 148, 141,
+    167, 165, 164,
+    168, 167, 166,
+    166, 169, 168,
+    170, 173, 171,
+    172, 171, 173,
+    185, 173, 170,
+    174, 172, 173,
+    176, 175, 179,
+    179, 170, 176,
+    192, 170, 179,
+    171, 176, 170,
+    182, 179, 177,
+    178, 177, 179,
+    175, 178, 179,
+    181, 174, 173,
+    173, 182, 181,
+    177, 181, 182,
+    192, 185, 170,
+    183, 186, 187,
+    186, 188, 190,
+    191, 194, 193,
+    195, 193, 194,
+    194, 183, 195,
+    184, 195, 183,
+    179, 182, 198,
+    196, 199, 200,
+    201, 200, 199,
+    199, 191, 201,
+    198, 192, 179,
+    193, 201, 191,
+    185, 182, 173,
+    188, 202, 203,
+    202, 196, 197,
+    189, 198, 182,
+    0, 4, 1,
+    2, 1, 4,
+    5, 2, 4,
+    17, 15, 16,
+    16, 18, 17,
+    19, 17, 18,
+    18, 20, 19,
+    21, 19, 20,
+    20, 0, 21,
+    1, 21, 0,
+    25, 28, 26,
+    25, 68, 69,
+    68, 25, 26,
+    71, 69, 70,
+    69, 71, 25,
+    72, 25, 71,
+    28, 25, 72,
+    70, 73, 71,
+    74, 71, 73,
+    71, 74, 72,
+    54, 72, 74,
+    30, 72, 54,
+    72, 30, 28,
+    74, 52, 54,
+    104, 70, 69,
+    22, 26, 23,
+    24, 23, 26,
+    27, 24, 26,
+    34, 32, 33,
+    33, 35, 34,
+    36, 34, 35,
+    35, 37, 36,
+    38, 36, 37,
+    37, 22, 38,
+    23, 38, 22,
+    40, 39, 41,
+    39, 42, 41,
+    43, 41, 42,
+    41, 43, 0,
+    4, 0, 43,
+    59, 62, 60,
+    63, 60, 62,
+    60, 63, 61,
+    20, 61, 63,
+    61, 20, 18,
+    62, 64, 63,
+    40, 63, 64,
+    41, 63, 40,
+    63, 41, 20,
+    64, 39, 40,
+    0, 20, 41,
+    64, 86, 39,
+    42, 39, 86,
+    53, 52, 95,
+    52, 53, 54,
+    54, 53, 30,
+    13, 30, 53,
+    56, 95, 55,
+    95, 56, 53,
+    53, 56, 13,
+    55, 57, 56,
+    58, 56, 57,
+    56, 58, 13,
+    16, 13, 58,
+    57, 59, 58,
+    60, 58, 59,
+    61, 58, 60,
+    58, 61, 16,
+    18, 16, 61,
+    52, 74, 73,
+    73, 132, 52,
+    95, 52, 132,
+    132, 73, 95,
+    102, 67, 65,
+    68, 65, 67,
+    65, 68, 66,
+    66, 68, 22,
+    26, 22, 68,
+    67, 69, 68,
+    82, 102, 83,
+    65, 83, 102,
+    66, 83, 65,
+    83, 66, 37,
+    22, 37, 66,
+    69, 67, 104,
+    75, 77, 76,
+    78, 76, 77,
+    77, 79, 78,
+    80, 78, 79,
+    81, 78, 80,
+    78, 81, 33,
+    35, 33, 81,
+    79, 82, 80,
+    83, 80, 82,
+    80, 83, 81,
+    37, 81, 83,
+    81, 37, 35,
+    84, 87, 85,
+    86, 85, 87,
+    88, 86, 87,
+    87, 89, 88,
+    45, 88, 89,
+    48, 45, 89,
+    89, 90, 48,
+    91, 48, 90,
+    92, 48, 91,
+    90, 107, 91,
+    75, 91, 107,
+    91, 75, 92,
+    77, 75, 107,
+    107, 108, 77,
+    79, 77, 108,
+    85, 86, 64,
+    93, 97, 96,
+    57, 96, 97,
+    97, 98, 57,
+    99, 57, 98,
+    59, 57, 99,
+    62, 99, 98,
+    99, 62, 59,
+    98, 84, 62,
+    85, 62, 84,
+    64, 62, 85,
+    96, 94, 93,
+    94, 96, 95,
+    55, 95, 96,
+    96, 57, 55,
+    70, 104, 105,
+    94, 105, 106,
+    105, 94, 70,
+    73, 70, 94,
+    94, 106, 93,
+    95, 73, 94,
+    100, 103, 101,
+    67, 101, 103,
+    101, 67, 102,
+    104, 67, 103,
+    103, 106, 104,
+    105, 104, 106,
+    82, 79, 108,
+    108, 100, 82,
+    101, 82, 100,
+    102, 82, 101,
+    141, 137, 163,
+    141, 145, 137,
+    137, 145, 142,
+    146, 143, 142,
+    143, 146, 144,
+    145, 149, 142,
+    142, 149, 146,
+    147, 144, 146,
+    150, 151, 152,
+    148, 153, 150,
+    155, 150, 153,
+    150, 155, 151,
+    148, 167, 153,
+    151, 154, 152,
+    151, 155, 154,
+    165, 167, 148,
+    156, 154, 155,
+    167, 160, 153,
+    156, 155, 153,
+    156, 159, 154,
+    157, 153, 160,
+    153, 157, 156,
+    156, 158, 159,
+    167, 168, 160,
+    139, 143, 140,
+    168, 163, 137,
+    142, 138, 137,
+    138, 142, 143,
+    144, 140, 143,
+    138, 161, 157,
+    140, 162, 139,
+    168, 137, 160,
+    160, 137, 157,
+    157, 137, 138,
+    143, 161, 138,
+    161, 143, 139,
+    174, 171, 172,
+    171, 174, 180,
+    171, 175, 176,
+    175, 171, 180,
+    175, 177, 178,
+    177, 175, 180,
+    177, 174, 181,
+    174, 177, 180,
+    187, 184, 183,
+    184, 187, 185,
+    190, 187, 186,
+    187, 190, 185,
+    189, 185, 190,
+    201, 193, 192,
+    193, 195, 192,
+    195, 184, 192,
+    185, 192, 184,
+    200, 197, 196,
+    197, 200, 198,
+    200, 201, 198,
+    192, 198, 201,
+    203, 190, 188,
+    190, 203, 189,
+    182, 185, 189,
+    197, 203, 202,
+    203, 197, 189,
+    198, 189, 197,
+};
+
+// Teapot triangle planes, parallel to teapot_decimated_indices
+// Each plane is 4 floats (normal x, y, z, offset), the unit normal
+// follows the winding and offset is dot(normal, vertex 1)
+static const float teapot_decimated_face_planes[] = {
+    0.381504f, 0.787363f, 0.484267f, 1.455015f,
+    0.427499f, 0.343934f, 0.836034f, 1.638232f,
+    0.459797f, 0.377956f, 0.803577f, 1.602364f,
+    0.382559f, 0.440195f, 0.812328f, 1.604168f,
+    0.719809f, 0.002394f, 0.694168f, 1.833346f,
+    0.651428f, 0.371850f, 0.661339f, 1.558761f,
+    0.610102f, 0.344350f, 0.713582f, 1.573479f,
+    0.679035f, 0.460998f, 0.571308f, 1.533208f,
+    0.888504f, 0.002219f, 0.458864f, 1.789552f,
+    0.889978f, 0.005360f, 0.455972f, 1.786987f,
+    0.832736f, 0.349415f, 0.429488f, 1.545161f,
+    0.838259f, 0.381091f, 0.389990f, 1.517265f,
+    0.768436f, 0.453822f, 0.451166f, 1.513361f,
+    0.455852f, -0.053066f, 0.888472f, 1.917561f,
+    0.455997f, -0.052909f, 0.888407f, 1.917431f,
+    0.682078f, -0.050774f, 0.729514f, 1.876658f,
+    0.617501f, 0.750649f, 0.234986f, 1.443844f,
+    0.986817f, 0.004992f, 0.161762f, 1.761176f,
+    0.990093f, 0.036901f, 0.135481f, 1.737895f,
+    0.919592f, 0.372775f, 0.124050f, 1.486493f,
+    0.919654f, 0.351588f, 0.174995f, 1.494921f,
+    0.891973f, 0.447571f, 0.063743f, 1.479223f,
+    0.880824f, 0.472945f, -0.021738f, 1.469973f,
+    0.984632f, 0.040058f, -0.169985f, 1.725064f,
+    0.988540f, 0.019002f, -0.149759f, 1.740046f,
+    0.932294f, 0.347754f, -0.099477f, 1.516936f,
+    0.905902f, 0.396375f, -0.149088f, 1.489991f,
+    0.811921f, 0.410833f, -0.414730f, 1.497484f,
+    0.811325f, 0.411254f, -0.415477f, 1.497416f,
+    -0.600450f, -0.254184f, -0.758189f, -1.433944f,
+    -0.693579f, 0.194668f, -0.693579f, -1.081661f,
+    -0.891107f, 0.294610f, -0.345156f, -0.895802f,
+    -0.840419f, -0.324904f, -0.433744f, -1.387344f,
+    -0.906394f, 0.404355f, -0.122257f, -0.773584f,
+    -0.226415f, 0.972986f, 0.045099f, 1.196752f,
+    0.890190f, -0.424340f, -0.165825f, -1.767776f,
+    0.735117f, -0.671431f, -0.093716f, -1.699296f,
+    0.600371f, -0.254660f, 0.758091f, -1.700724f,
+    0.693658f, 0.194107f, 0.693658f, -1.390226f,
+    0.860255f, 0.275898f, 0.428767f, -1.333762f,
+    0.867601f, 0.216550f, 0.447632f, -1.404166f,
+    0.878335f, 0.463075f, 0.118698f, -1.086417f,
+    0.248282f, 0.966964f, -0.057759f, 1.123097f,
+    -0.959334f, -0.181831f, 0.215905f, -1.273710f,
+    -0.735388f, -0.671107f, 0.093912f, -1.373032f,
+    -0.540310f, 0.841444f, 0.006049f, 2.028301f,
+    -0.671823f, 0.074817f, 0.736924f, 2.274849f,
+    -0.283641f, 0.464006f, 0.839194f, 1.191092f,
+    -0.304906f, 0.473509f, 0.826330f, 1.256252f,
+    -0.041817f, 0.798946f, 0.599947f, 0.639027f,
+    0.104641f, -0.010577f, 0.994454f, -0.048570f,
+    0.399502f, -0.158494f, 0.902927f, -1.062449f,
+    0.432996f, -0.714993f, 0.548907f, -1.385867f,
+    -0.003415f, -0.737545f, 0.675290f, -0.176899f,
+    0.760370f, -0.538728f, -0.362780f, -2.322810f,
+    0.038949f, -0.996900f, -0.068366f, -0.462030f,
+    0.120403f, -0.956250f, 0.266626f, -0.637414f,
+    0.226678f, -0.601966f, -0.765672f, -0.727312f,
+    0.061042f, -0.530987f, -0.845179f, -0.213903f,
+    0.004041f, -0.838913f, -0.544251f, -0.273140f,
+    -0.221531f, 0.553961f, -0.802528f, 1.071492f,
+    -0.020989f, 0.746935f, -0.664566f, 0.570795f,
+    -0.026854f, 0.773520f, -0.633203f, 0.591980f,
+    -0.036512f, 0.997245f, -0.064565f, 0.657512f,
+    -0.988955f, 0.144837f, 0.031473f, 3.132595f,
+    -0.985103f, -0.051768f, -0.163991f, 3.101329f,
+    -0.650756f, 0.742740f, -0.157655f, 2.321945f,
+    -0.050689f, 0.998682f, -0.008066f, 0.690679f,
+    -0.843929f, -0.529357f, 0.086976f, 2.753101f,
+    -0.488920f, -0.859088f, 0.151408f, 1.948071f,
+    -0.409863f, -0.690569f, 0.595925f, 1.678045f,
+    -0.434264f, -0.374081f, 0.819437f, 1.583507f,
+    0.202520f, 0.059942f, 0.977442f, -0.336106f,
+    -0.137740f, -0.070011f, 0.987991f, 0.644088f,
+    0.291959f, 0.595065f, 0.748771f, -0.983359f,
+    0.779192f, 0.411730f, 0.472586f, -2.202085f,
+    0.788396f, 0.421431f, 0.448137f, -2.234041f,
+    0.533096f, 0.846043f, 0.004353f, -1.830983f,
+    0.847531f, 0.479656f, -0.227206f, -2.497317f,
+    0.952772f, 0.205748f, 0.223366f, -2.762477f,
+    0.547561f, 0.835912f, 0.037789f, -1.859950f,
+    0.365134f, 0.173409f, -0.914662f, -0.909871f,
+    0.531099f, 0.108099f, -0.840386f, -1.422101f,
+    0.222205f, 0.208335f, -0.952482f, -0.521175f,
+    0.052057f, 0.033678f, -0.998076f, 0.028811f,
+    0.202520f, -0.006021f, -0.979260f, -0.375268f,
+    -0.538559f, -0.317771f, -0.780369f, 1.868926f,
+    -0.557433f, -0.101887f, -0.823947f, 1.906004f,
+    -0.503385f, -0.852826f, -0.138893f, 1.971781f,
+    -0.522493f, -0.850161f, -0.065023f, 2.009548f,
+    -0.794270f, -0.599739f, -0.097200f, 2.629381f,
+    -0.179388f, 0.276272f, 0.944190f, -0.116585f,
+    -0.079280f, 0.302573f, 0.949823f, 0.149389f,
+    0.057797f, 0.125625f, 0.990393f, 0.515827f,
+    -0.525637f, 0.375557f, 0.763323f, -0.915596f,
+    -0.150606f, 0.624623f, 0.766267f, -0.181046f,
+    -0.140800f, 0.615314f, 0.775605f, -0.156697f,
+    0.679868f, -0.148891f, -0.718061f, 1.851434f,
+    0.544598f, -0.243620f, -0.802535f, 1.611880f,
+    0.499533f, -0.549582f, -0.669647f, 1.638401f,
+    0.132687f, -0.564158f, -0.814936f, 0.989408f,
+    0.165313f, -0.528670f, -0.832574f, 1.024403f,
+    -0.177440f, 0.983746f, -0.027540f, 0.250038f,
+    -0.208224f, 0.977813f, 0.022904f, 0.153417f,
+    0.012846f, -0.143293f, -0.989597f, -0.199244f,
+    -0.105096f, 0.876074f, 0.470583f, 0.451447f,
+    0.157377f, -0.936432f, -0.313573f, -0.302656f,
+    0.010988f, -0.222562f, 0.974857f, -0.248760f,
+    -0.150968f, 0.987374f, 0.047968f, 0.330812f,
+    0.405534f, -0.487188f, 0.773428f, -0.530261f,
+    0.051220f, -0.698126f, 0.714140f, -0.744946f,
+    0.273653f, 0.837675f, 0.472668f, 0.938673f,
+    0.686634f, -0.567791f, 0.454035f, -0.654464f,
+    -0.814792f, -0.573581f, 0.084372f, -0.334597f,
+    -0.610187f, -0.695827f, 0.378810f, -0.560354f,
+    -0.530688f, 0.843209f, 0.085846f, 1.094221f,
+    -0.444275f, -0.585791f, 0.677842f, -0.434118f,
+    -0.169270f, -0.590860f, -0.788817f, -0.522415f,
+    -0.068273f, -0.637054f, -0.767790f, -0.609843f,
+    -0.698334f, -0.541911f, -0.467614f, -0.303216f,
+    0.814867f, -0.573471f, -0.084399f, -0.696222f,
+    0.732370f, -0.643412f, -0.222833f, -0.775660f,
+    0.455848f, -0.564604f, -0.688059f, -0.597783f,
+    -0.000865f, 0.501302f, 0.865272f, 0.694969f,
+    0.547216f, -0.013850f, 0.836877f, 1.140476f,
+    0.902442f, -0.387389f, 0.188489f, 0.652496f,
+    -0.796705f, 0.306497f, 0.520885f, 1.617973f,
+    -0.507918f, 0.765279f, 0.395434f, 1.528593f,
+    -0.162530f, 0.606154f, 0.778564f, 1.477102f,
+    -0.242356f, 0.193888f, 0.950616f, 1.390690f,
+    -0.050606f, 0.939855f, -0.337804f, 1.056965f,
+    -0.547167f, -0.014139f, -0.836904f, 1.383198f,
+    -0.373430f, 0.892248f, -0.253856f, 1.366183f,
+    -0.978648f, -0.022434f, -0.204318f, 1.440340f,
+    -0.738847f, 0.673085f, -0.032584f, 0.993088f,
+    -0.526535f, 0.850125f, 0.006976f, 1.455942f,
+    0.896647f, -0.119615f, -0.426282f, -0.213317f,
+    0.836862f, -0.013697f, -0.547242f, 1.076302f,
+    0.188372f, -0.387846f, -0.902270f, 0.810407f,
+    0.121231f, 0.854403f, -0.505271f, 0.958411f,
+    -0.171246f, 0.450263f, -0.876320f, -0.860227f,
+    -0.129275f, 0.235279f, -0.963292f, -1.152401f,
+    -0.425294f, 0.370750f, -0.825633f, -0.934710f,
+    0.823327f, 0.376946f, -0.424316f, -1.203734f,
+    0.644280f, 0.324385f, -0.692587f, -1.224087f,
+    0.693698f, 0.194621f, -0.693474f, -1.389673f,
+    0.442700f, 0.273230f, -0.854027f, -1.247659f,
+    0.439996f, 0.281210f, -0.852833f, -1.237434f,
+    0.022175f, 0.513422f, -0.857849f, -0.787000f,
+    0.131235f, 0.022007f, -0.991107f, -1.408484f,
+    -0.381412f, 0.787478f, -0.484151f, 1.624252f,
+    -0.453926f, 0.377814f, -0.806975f, 1.803826f,
+    -0.379374f, 0.412775f, -0.828066f, 1.769486f,
+    -0.717700f, 0.039026f, -0.695257f, 2.136445f,
+    -0.651505f, 0.371842f, -0.661267f, 1.848012f,
+    -0.610200f, 0.344360f, -0.713493f, 1.844396f,
+    -0.679127f, 0.460997f, -0.571199f, 1.834693f,
+    -0.893537f, 0.038173f, -0.447365f, 2.165984f,
+    -0.889562f, 0.025777f, -0.456087f, 2.173724f,
+    -0.832673f, 0.349421f, -0.429605f, 1.914861f,
+    -0.836094f, 0.367624f, -0.407185f, 1.900943f,
+    -0.799812f, 0.448675f, -0.398738f, 1.850021f,
+    -0.800723f, 0.447797f, -0.397896f, 1.850446f,
+    -0.933136f, 0.324272f, -0.155259f, 1.961759f,
+    -0.665430f, -0.051097f, -0.744710f, 2.180913f,
+    0.171532f, 0.451647f, 0.875552f, -0.934215f,
+    0.129277f, 0.235174f, 0.963317f, -1.209918f,
+    0.425351f, 0.370436f, 0.825744f, -1.123978f,
+    -0.823630f, 0.376345f, 0.424262f, -0.838915f,
+    -0.644402f, 0.323881f, 0.692710f, -0.938663f,
+    -0.693579f, 0.194669f, 0.693579f, -1.081660f,
+    -0.440724f, 0.273706f, 0.854896f, -1.050499f,
+    -0.441166f, 0.272366f, 0.855096f, -1.052007f,
+    -0.011304f, 0.548203f, 0.836269f, -0.719480f,
+    -0.131170f, 0.005574f, 0.991344f, -1.362819f,
+    0.015719f, 0.326713f, 0.944993f, 1.736025f,
+    0.139553f, 0.355412f, 0.924233f, 1.681375f,
+    0.125521f, 0.344009f, 0.930539f, 1.692354f,
+    0.127097f, 0.430564f, 0.893566f, 1.649952f,
+    0.178271f, 0.453660f, 0.873162f, 1.638569f,
+    -0.425549f, 0.037950f, 0.904140f, 2.053399f,
+    -0.436399f, 0.026498f, 0.899363f, 2.065307f,
+    -0.453624f, 0.350659f, 0.819307f, 1.837144f,
+    -0.376127f, 0.419768f, 0.826029f, 1.763260f,
+    -0.404716f, 0.448555f, 0.796871f, 1.764365f,
+    -0.168863f, 0.028278f, 0.985234f, 1.995672f,
+    -0.187626f, 0.009657f, 0.982193f, 2.011432f,
+    -0.116202f, 0.368731f, 0.922244f, 1.734708f,
+    -0.148067f, 0.402324f, 0.903444f, 1.717235f,
+    -0.038468f, 0.060750f, 0.997411f, 1.957324f,
+    -0.033050f, 0.469077f, 0.882539f, 1.674119f,
+    0.175783f, -0.049614f, 0.983178f, 1.976116f,
+    0.167445f, -0.055564f, 0.984314f, 1.981038f,
+    -0.987688f, 0.148408f, 0.049469f, 2.098433f,
+    -0.930199f, 0.364707f, -0.041461f, 1.915963f,
+    -0.898586f, 0.438249f, 0.021921f, 1.847042f,
+    -0.902960f, 0.429718f, 0.002392f, 1.854100f,
+    -0.974848f, 0.055203f, 0.215928f, 2.181357f,
+    -0.983678f, 0.147838f, 0.102579f, 2.100634f,
+    -0.903834f, 0.397467f, 0.158443f, 1.893487f,
+    -0.868322f, 0.056742f, 0.492744f, 2.131524f,
+    -0.888331f, 0.022849f, 0.458635f, 2.162184f,
+    -0.811838f, 0.410892f, 0.414834f, 1.857877f,
+    -0.811423f, 0.411185f, 0.415355f, 1.857646f,
+    -0.731306f, 0.024945f, 0.681593f, 2.136539f,
+    -0.721269f, 0.038884f, 0.691563f, 2.125852f,
+    -0.643856f, 0.350324f, 0.680237f, 1.880338f,
+    -0.673046f, 0.416572f, 0.611128f, 1.833187f,
+    -0.609983f, 0.460993f, 0.644521f, 1.810559f,
+    -0.986013f, 0.069496f, -0.151490f, 2.166948f,
+    -0.991366f, 0.049926f, -0.121244f, 2.178945f,
+    -0.996759f, 0.065138f, -0.047197f, 2.169065f,
+    -0.993831f, -0.078744f, -0.078097f, 2.276883f,
+    -0.169960f, 0.040058f, -0.984636f, 1.981394f,
+    -0.149736f, 0.019002f, -0.988543f, 1.992754f,
+    -0.099464f, 0.347742f, -0.932300f, 1.746011f,
+    -0.171358f, 0.417745f, -0.892259f, 1.711171f,
+    -0.181250f, 0.420311f, -0.889093f, 1.712901f,
+    -0.421805f, 0.021298f, -0.906436f, 2.069928f,
+    0.165327f, 0.028264f, -0.985834f, 1.920359f,
+    0.157416f, 0.036534f, -0.986856f, 1.916618f,
+    0.101651f, 0.353205f, -0.930007f, 1.696064f,
+    0.145861f, 0.400043f, -0.904815f, 1.653810f,
+    0.023547f, 0.468807f, -0.882987f, 1.662395f,
+    -0.486135f, -0.052864f, -0.872284f, 2.136221f,
+    0.889086f, 0.021483f, -0.457236f, 1.768512f,
+    0.888398f, 0.022727f, -0.458510f, 1.767805f,
+    0.706479f, 0.024988f, -0.707293f, 1.807679f,
+    0.725458f, 0.002397f, -0.688262f, 1.818160f,
+    0.643821f, 0.350417f, -0.680222f, 1.594416f,
+    0.672985f, 0.416617f, -0.611164f, 1.534343f,
+    0.609983f, 0.460993f, -0.644521f, 1.539707f,
+    0.458864f, 0.002285f, -0.888504f, 1.884872f,
+    0.436392f, 0.026439f, -0.899368f, 1.871598f,
+    0.453622f, 0.350725f, -0.819280f, 1.635695f,
+    0.375513f, 0.420334f, -0.826020f, 1.595850f,
+    0.402451f, 0.448272f, -0.798177f, 1.584580f,
+    0.132485f, -0.745584f, 0.653110f, 2.062887f,
+    0.127679f, -0.749922f, 0.649088f, 2.061636f,
+    0.328416f, -0.700130f, 0.634004f, 2.064256f,
+    0.463864f, -0.749291f, 0.472644f, 1.986433f,
+    0.486010f, -0.736779f, 0.470054f, 1.990385f,
+    0.640150f, -0.694664f, 0.328101f, 1.994416f,
+    0.652708f, -0.743851f, 0.143725f, 1.946865f,
+    0.652347f, -0.744088f, 0.144141f, 1.946765f,
+    0.867562f, -0.493312f, 0.063087f, 2.002584f,
+    0.653200f, -0.745486f, -0.132593f, 1.947330f,
+    0.656730f, -0.741606f, -0.136843f, 1.948495f,
+    0.865919f, -0.496305f, -0.062172f, 2.002303f,
+    0.638474f, -0.694877f, -0.330902f, 1.995324f,
+    0.478103f, -0.742509f, -0.469146f, 1.984195f,
+    0.476954f, -0.738018f, -0.477331f, 1.987787f,
+    0.067894f, -0.493981f, 0.866818f, 2.178356f,
+    -0.583960f, -0.765142f, 0.271198f, 2.229945f,
+    -0.603635f, -0.719705f, 0.343001f, 2.254264f,
+    -0.470787f, -0.715476f, 0.516191f, 2.211648f,
+    -0.487634f, -0.786121f, 0.379772f, 2.151763f,
+    -0.571578f, -0.495508f, 0.654042f, 2.338333f,
+    -0.291813f, -0.706656f, 0.644579f, 2.198595f,
+    -0.447357f, -0.494837f, 0.744989f, 2.309635f,
+    -0.143637f, -0.743868f, 0.652709f, 2.123628f,
+    -0.144171f, -0.744171f, 0.652245f, 2.123514f,
+    -0.065856f, -0.502425f, 0.862109f, 2.210454f,
+    -0.703834f, -0.710191f, 0.015679f, 2.272777f,
+    -0.854000f, -0.520078f, 0.014257f, 2.352167f,
+    -0.888029f, -0.445411f, 0.114081f, 2.385946f,
+    -0.791495f, -0.506219f, 0.342458f, 2.382961f,
+    -0.649161f, -0.495237f, -0.577347f, 2.354259f,
+    -0.625287f, -0.715278f, -0.312080f, 2.276064f,
+    -0.784520f, -0.489996f, -0.380042f, 2.363823f,
+    -0.766134f, -0.514502f, -0.385131f, 2.358092f,
+    -0.571341f, -0.816770f, -0.080347f, 2.176349f,
+    -0.891986f, -0.450833f, -0.033329f, 2.369634f,
+    -0.132485f, -0.745584f, -0.653110f, 2.121714f,
+    -0.136843f, -0.741606f, -0.656730f, 2.124681f,
+    -0.062167f, -0.496288f, -0.865929f, 2.208352f,
+    -0.322714f, -0.697498f, -0.639806f, 2.208649f,
+    -0.464871f, -0.749546f, -0.471250f, 2.191842f,
+    -0.391659f, -0.786818f, -0.476991f, 2.137460f,
+    0.328116f, -0.694629f, -0.640179f, 2.063724f,
+    0.143620f, -0.743859f, -0.652723f, 2.059859f,
+    0.144171f, -0.744171f, -0.652245f, 2.059497f,
+    0.063092f, -0.493329f, -0.867552f, 2.181191f,
+    0.262067f, -0.468578f, 0.843656f, 0.546858f,
+    0.613090f, -0.547034f, 0.569978f, 1.422603f,
+    0.613755f, -0.037138f, 0.788623f, 1.706802f,
+    0.420308f, -0.492131f, 0.762331f, 1.474730f,
+    0.268224f, -0.606371f, 0.748579f, 1.258676f,
+    0.468059f, 0.019166f, 0.883489f, 1.385973f,
+    0.309619f, -0.100576f, 0.945526f, 1.107446f,
+    -0.020885f, -0.203259f, 0.978902f, 0.575494f,
+    -0.168639f, 0.982733f, 0.076137f, -0.475507f,
+    -0.891734f, 0.424298f, 0.157423f, -1.854283f,
+    -0.936313f, 0.351095f, -0.007116f, -1.983065f,
+    -0.244377f, 0.954742f, 0.169549f, -0.599700f,
+    -0.588696f, 0.794352f, -0.149810f, -0.874344f,
+    -0.205768f, 0.975954f, -0.071927f, -0.567960f,
+    -0.368358f, 0.924750f, 0.095653f, -0.841251f,
+    -0.029664f, 0.980560f, 0.193965f, 0.679392f,
+    -0.175293f, 0.599829f, -0.780690f, -0.211205f,
+    -0.165047f, 0.348379f, -0.922709f, -0.054457f,
+    -0.581753f, 0.339387f, -0.739175f, -1.062936f,
+    -0.177801f, 0.572537f, -0.800367f, -0.201352f,
+    -0.125080f, 0.154085f, -0.980109f, -0.072994f,
+    0.009474f, 0.320225f, -0.947294f, 0.341499f,
+    0.085088f, 0.113186f, -0.989924f, 0.580704f,
+    -0.047993f, 0.775745f, -0.629218f, 0.555287f,
+    0.341792f, -0.939645f, 0.015688f, 1.503801f,
+    0.536805f, -0.837150f, 0.104981f, 1.023605f,
+    0.873493f, -0.254072f, 0.415281f, 2.256727f,
+    0.752968f, -0.558980f, 0.347247f, 2.102741f,
+    0.202587f, -0.840654f, 0.502254f, 1.261278f,
+    0.954457f, -0.279961f, -0.103118f, 2.394897f,
+    0.207598f, -0.968686f, -0.136202f, 1.314934f,
+    0.341538f, -0.838068f, -0.425434f, 0.446630f,
+    0.727149f, -0.685666f, 0.033409f, 1.605323f,
+    0.944331f, -0.293774f, -0.148109f, 2.371361f,
+    0.745821f, -0.666109f, 0.007077f, 2.091683f,
+    0.665042f, -0.742422f, -0.080797f, 1.969439f,
+    0.161324f, 0.947666f, 0.275508f, 1.436039f,
+    0.080592f, 0.987199f, 0.137634f, 1.464522f,
+    -0.275508f, 0.947666f, 0.161324f, 1.533023f,
+    -0.137634f, 0.987199f, 0.080592f, 1.512972f,
+    -0.161334f, 0.947643f, -0.275580f, 1.507653f,
+    -0.080587f, 0.987197f, -0.137652f, 1.500303f,
+    0.275630f, 0.947627f, -0.161342f, 1.410652f,
+    0.137626f, 0.987203f, -0.080560f, 1.451865f,
+    0.124475f, 0.892985f, 0.432531f, 1.253214f,
+    0.046711f, 0.985132f, 0.165327f, 1.013282f,
+    0.364811f, 0.900157f, 0.237970f, 1.186006f,
+    0.149440f, 0.983946f, 0.097561f, 0.996886f,
+    0.154187f, 0.988032f, 0.004321f, 0.979530f,
+    -0.163847f, 0.986375f, 0.014797f, 1.053256f,
+    -0.144692f, 0.984022f, 0.103758f, 1.062682f,
+    -0.040206f, 0.985440f, 0.165201f, 1.030846f,
+    -0.001704f, 0.987759f, 0.155977f, 1.013572f,
+    -0.076973f, 0.926391f, -0.368612f, 1.224130f,
+    -0.036954f, 0.983567f, -0.176720f, 1.034962f,
+    -0.135511f, 0.985813f, -0.099045f, 1.052761f,
+    -0.135455f, 0.990227f, -0.033220f, 1.033169f,
+    0.368459f, 0.926455f, -0.076941f, 1.125107f,
+    0.176725f, 0.983566f, -0.036955f, 0.987526f,
+    0.368084f, 0.927018f, 0.071777f, 0.935344f,
+    0.237970f, 0.900157f, -0.364811f, 1.214167f,
+    0.093214f, 0.985356f, -0.142772f, 1.001050f,
+    0.033166f, 0.989844f, -0.138232f, 0.995973f,
+};
+
+// Triangle clusters, each is 2 values (first triangle, triangle count)
+static const uint16_t teapot_decimated_clusters[] = {
+    0, 16,
+    16, 13,
+    29, 111,
+    140, 10,
+    150, 15,
+    165, 10,
+    175, 18,
+    193, 20,
+    213, 12,
+    225, 12,
+    237, 15,
+    252, 11,
+    263, 10,
+    273, 10,
+    283, 8,
+    291, 8,
+    299, 8,
+    307, 12,
+    319, 8,
+    327, 19,
+};
+
+// Cluster bounds, parallel to teapot_decimated_clusters
+// Each is 9 floats: bounding sphere center x, y, z and radius, normal
+// cone axis x, y, z, cosine and sine of the cone half-angle
+static const float teapot_decimated_cluster_bounds[] = {
+    0.990065f, -0.091563f, 1.195934f, 1.311220f, 0.674502f, 0.277447f, 0.684156f, 0.807091f, 0.590427f,
+    1.378814f, -0.076549f, -0.172247f, 1.438422f, 0.943298f, 0.329208f, -0.042561f, 0.819606f, 0.572927f,
+    0.017180f, 0.196713f, 0.000000f, 3.272986f, -0.407391f, 0.781775f, 0.472082f, 0.000000f, 1.000000f,
+    -0.474111f, 0.806200f, 0.945415f, 1.201403f, 0.276562f, 0.340401f, -0.898688f, 0.737342f, 0.675520f,
+    -1.464274f, -0.090283f, -1.055882f, 1.237718f, -0.743304f, 0.335125f, -0.578956f, 0.827711f, 0.561154f,
+    0.030078f, 0.806101f, -0.944824f, 1.201158f, -0.275758f, 0.342145f, 0.898273f, 0.736990f, 0.675903f,
+    -0.502466f, -0.091219f, 1.599551f, 1.355907f, -0.108482f, 0.258322f, 0.959949f, 0.911915f, 0.410380f,
+    -1.648286f, -0.075564f, 0.498380f, 1.462603f, -0.931905f, 0.230473f, 0.280062f, 0.855198f, 0.518301f,
+    -0.497444f, -0.090037f, -1.689391f, 1.321684f, -0.094556f, 0.217702f, -0.971424f, 0.881816f, 0.471594f,
+    0.920801f, -0.076549f, -1.270711f, 1.363492f, 0.634265f, 0.222483f, -0.740412f, 0.907238f, 0.420617f,
+    0.778878f, -1.206370f, 0.129764f, 2.002721f, 0.604707f, -0.783113f, 0.145131f, 0.758685f, 0.651458f,
+    -0.806200f, -1.205977f, 1.160047f, 1.427488f, -0.358828f, -0.687246f, 0.631613f, 0.862618f, 0.505856f,
+    -1.820878f, -1.169105f, -0.205673f, 1.465667f, -0.791674f, -0.595878f, -0.134839f, 0.882074f, 0.471110f,
+    -0.384910f, -1.206370f, -1.367295f, 1.391341f, -0.086970f, -0.720797f, -0.687669f, 0.904764f, 0.425914f,
+    2.328365f, -0.026337f, 0.301420f, 1.220788f, 0.388418f, -0.322453f, 0.863224f, 0.902441f, 0.430813f,
+    2.144352f, 0.250076f, 0.004037f, 0.905490f, -0.472450f, 0.879043f, 0.063828f, 0.750534f, 0.660831f,
+    2.351896f, 0.098061f, -0.316878f, 1.162382f, -0.154898f, 0.423703f, -0.892458f, 0.893595f, 0.448875f,
+    2.352142f, -0.113568f, 0.066408f, 1.299351f, 0.677275f, -0.734068f, 0.049427f, 0.779129f, 0.626864f,
+    -0.222016f, 1.459351f, 0.000000f, 0.415454f, 0.000014f, 1.000000f, -0.000010f, 0.947632f, 0.319363f,
+    -0.161417f, 0.913171f, 0.000000f, 1.384343f, 0.075331f, 0.997158f, 0.000649f, 0.900105f, 0.435672f,
+};
+
+// Unique teapot edges with their adjacent triangles
+// Each edge is 4 indices (vertex 1, vertex 2, face 1, face 2),
+// face 2 is TEAPOT_NO_FACE on open borders
+static const uint16_t teapot_decimated_edges[] = {
+    0, 4, 140, 179,
+    1, 4, 140, 141,
+    0, 1, 140, 149,
+    1, 2, 141, 65535,
+    2, 4, 141, 142,
+    2, 5, 142, 65535,
+    4, 5, 142, 29,
+    3, 6, 0, 7,
+    4, 6, 0, 29,
+    3, 4, 0, 3,
+    5, 6, 29, 30,
+    5, 7, 30, 65535,
+    6, 7, 30, 31,
+    6, 9, 16, 31,
+    6, 8, 16, 12,
+    8, 9, 16, 21,
+    7, 9, 31, 32,
+    7, 10, 32, 65535,
+    9, 10, 32, 33,
+    10, 11, 33, 65535,
+    9, 11, 33, 43,
+    16, 30, 34, 35,
+    13, 30, 34, 196,
+    13, 16, 34, 203,
+    14, 16, 35, 36,
+    14, 30, 35, 41,
+    14, 15, 36, 65535,
+    15, 16, 36, 143,
+    15, 17, 143, 65535,
+    16, 17, 143, 144,
+    16, 18, 144, 208,
+    17, 18, 144, 145,
+    17, 19, 145, 65535,
+    18, 19, 145, 146,
+    18, 20, 146, 184,
+    19, 20, 146, 147,
+    19, 21, 147, 65535,
+    20, 21, 147, 148,
+    0, 20, 148, 190,
+    0, 21, 148, 149,
+    1, 21, 149, 65535,
+    22, 26, 165, 217,
+    23, 26, 165, 166,
+    22, 23, 165, 174,
+    23, 24, 166, 65535,
+    24, 26, 166, 167,
+    24, 27, 167, 65535,
+    26, 27, 167, 37,
+    25, 28, 150, 156,
+    26, 28, 150, 37,
+    25, 26, 150, 152,
+    27, 28, 37, 38,
+    27, 29, 38, 65535,
+    28, 29, 38, 39,
+    28, 30, 39, 162,
+    29, 30, 39, 40,
+    29, 31, 40, 65535,
+    30, 31, 40, 41,
+    14, 31, 41, 65535,
+    9, 33, 42, 43,
+    9, 12, 42, 22,
+    12, 33, 42, 28,
+    11, 33, 43, 44,
+    11, 32, 44, 65535,
+    32, 33, 44, 168,
+    32, 34, 168, 65535,
+    33, 34, 168, 169,
+    33, 35, 169, 231,
+    34, 35, 169, 170,
+    34, 36, 170, 65535,
+    35, 36, 170, 171,
+    35, 37, 171, 236,
+    36, 37, 171, 172,
+    36, 38, 172, 65535,
+    37, 38, 172, 173,
+    22, 37, 173, 223,
+    22, 38, 173, 174,
+    23, 38, 174, 65535,
+    39, 40, 175, 189,
+    39, 41, 175, 176,
+    40, 41, 175, 187,
+    39, 42, 176, 192,
+    41, 42, 176, 177,
+    41, 43, 177, 178,
+    42, 43, 177, 1,
+    0, 43, 178, 179,
+    0, 41, 178, 190,
+    4, 43, 179, 3,
+    42, 44, 1, 14,
+    43, 44, 1, 2,
+    3, 43, 2, 3,
+    3, 44, 2, 5,
+    44, 46, 4, 5,
+    44, 45, 4, 15,
+    45, 46, 4, 8,
+    3, 46, 5, 6,
+    3, 47, 6, 7,
+    46, 47, 6, 10,
+    6, 47, 7, 12,
+    45, 48, 8, 242,
+    46, 48, 8, 9,
+    46, 49, 9, 10,
+    48, 49, 9, 17,
+    47, 49, 10, 11,
+    8, 47, 11, 12,
+    8, 49, 11, 19,
+    48, 92, 17, 245,
+    49, 92, 17, 18,
+    49, 50, 18, 19,
+    50, 92, 18, 23,
+    8, 50, 19, 20,
+    8, 51, 20, 21,
+    50, 51, 20, 25,
+    9, 51, 21, 22,
+    52, 53, 193, 194,
+    52, 95, 193, 211,
+    53, 95, 193, 198,
+    53, 54, 194, 195,
+    52, 54, 194, 163,
+    30, 53, 195, 196,
+    30, 54, 195, 161,
+    13, 53, 196, 199,
+    56, 95, 197, 198,
+    55, 95, 197, 265,
+    55, 56, 197, 200,
+    53, 56, 198, 199,
+    13, 56, 199, 202,
+    55, 57, 200, 266,
+    56, 57, 200, 201,
+    56, 58, 201, 202,
+    57, 58, 201, 204,
+    13, 58, 202, 203,
+    16, 58, 203, 207,
+    57, 59, 204, 257,
+    58, 59, 204, 205,
+    58, 60, 205, 206,
+    59, 60, 205, 180,
+    58, 61, 206, 207,
+    60, 61, 206, 182,
+    16, 61, 207, 208,
+    18, 61, 208, 184,
+    59, 62, 180, 259,
+    60, 62, 180, 181,
+    60, 63, 181, 182,
+    62, 63, 181, 185,
+    61, 63, 182, 183,
+    20, 61, 183, 184,
+    20, 63, 183, 188,
+    62, 64, 185, 262,
+    63, 64, 185, 186,
+    40, 63, 186, 187,
+    40, 64, 186, 189,
+    41, 63, 187, 188,
+    20, 41, 188, 190,
+    39, 64, 189, 191,
+    67, 102, 213, 275,
+    65, 67, 213, 214,
+    65, 102, 213, 220,
+    65, 68, 214, 215,
+    67, 68, 214, 218,
+    66, 68, 215, 216,
+    65, 66, 215, 221,
+    22, 68, 216, 217,
+    22, 66, 216, 223,
+    26, 68, 217, 152,
+    67, 69, 218, 224,
+    68, 69, 218, 151,
+    25, 68, 151, 152,
+    25, 69, 151, 154,
+    69, 71, 153, 154,
+    69, 70, 153, 164,
+    70, 71, 153, 157,
+    25, 71, 154, 155,
+    25, 72, 155, 156,
+    71, 72, 155, 159,
+    28, 72, 156, 162,
+    70, 73, 157, 270,
+    71, 73, 157, 158,
+    71, 74, 158, 159,
+    73, 74, 158, 209,
+    72, 74, 159, 160,
+    54, 72, 160, 161,
+    54, 74, 160, 163,
+    30, 72, 161, 162,
+    52, 74, 209, 163,
+    52, 73, 209, 210,
+    73, 132, 210, 212,
+    52, 132, 210, 211,
+    95, 132, 211, 212,
+    12, 51, 22, 26,
+    75, 92, 23, 248,
+    50, 75, 23, 24,
+    50, 76, 24, 25,
+    75, 76, 24, 225,
+    51, 76, 25, 26,
+    12, 76, 26, 27,
+    75, 77, 225, 249,
+    76, 77, 225, 226,
+    76, 78, 226, 27,
+    77, 78, 226, 227,
+    12, 78, 27, 28,
+    33, 78, 28, 230,
+    77, 79, 227, 251,
+    78, 79, 227, 228,
+    78, 80, 228, 229,
+    79, 80, 228, 232,
+    78, 81, 229, 230,
+    80, 81, 229, 234,
+    33, 81, 230, 231,
+    35, 81, 231, 236,
+    79, 82, 232, 279,
+    80, 82, 232, 233,
+    80, 83, 233, 234,
+    82, 83, 233, 219,
+    81, 83, 234, 235,
+    37, 81, 235, 236,
+    37, 83, 235, 222,
+    82, 102, 219, 282,
+    83, 102, 219, 220,
+    65, 83, 220, 221,
+    66, 83, 221, 222,
+    37, 66, 222, 223,
+    84, 87, 237, 65535,
+    85, 87, 237, 238,
+    84, 85, 237, 261,
+    85, 86, 238, 252,
+    86, 87, 238, 239,
+    64, 86, 252, 191,
+    64, 85, 252, 262,
+    39, 86, 191, 192,
+    42, 86, 192, 13,
+    86, 88, 239, 13,
+    87, 88, 239, 240,
+    42, 88, 13, 14,
+    44, 88, 14, 15,
+    87, 89, 240, 65535,
+    88, 89, 240, 241,
+    45, 88, 241, 15,
+    45, 89, 241, 242,
+    48, 89, 242, 243,
+    89, 90, 243, 65535,
+    48, 90, 243, 244,
+    48, 91, 244, 245,
+    90, 91, 244, 246,
+    91, 92, 245, 248,
+    94, 96, 263, 264,
+    93, 94, 263, 271,
+    93, 96, 263, 253,
+    95, 96, 264, 265,
+    94, 95, 264, 272,
+    55, 96, 265, 266,
+    93, 97, 253, 65535,
+    96, 97, 253, 254,
+    57, 96, 254, 266,
+    57, 97, 254, 255,
+    97, 98, 255, 65535,
+    57, 98, 255, 256,
+    57, 99, 256, 257,
+    98, 99, 256, 258,
+    59, 99, 257, 259,
+    62, 99, 258, 259,
+    62, 98, 258, 260,
+    84, 98, 260, 65535,
+    62, 84, 260, 261,
+    62, 85, 261, 262,
+    100, 103, 273, 65535,
+    101, 103, 273, 274,
+    100, 101, 273, 281,
+    67, 101, 274, 275,
+    67, 103, 274, 276,
+    101, 102, 275, 282,
+    67, 104, 276, 224,
+    103, 104, 276, 277,
+    69, 104, 224, 164,
+    103, 106, 277, 65535,
+    104, 106, 277, 278,
+    104, 105, 278, 267,
+    105, 106, 278, 268,
+    70, 104, 267, 164,
+    70, 105, 267, 269,
+    94, 105, 268, 269,
+    94, 106, 268, 271,
+    70, 94, 269, 270,
+    73, 94, 270, 272,
+    93, 106, 271, 65535,
+    73, 95, 272, 212,
+    90, 107, 246, 65535,
+    91, 107, 246, 247,
+    75, 91, 247, 248,
+    75, 107, 247, 249,
+    77, 107, 249, 250,
+    107, 108, 250, 65535,
+    77, 108, 250, 251,
+    79, 108, 251, 279,
+    82, 108, 279, 280,
+    100, 108, 280, 65535,
+    82, 100, 280, 281,
+    82, 101, 281, 282,
+    110, 121, 45, 67,
+    109, 121, 45, 66,
+    109, 110, 45, 47,
+    109, 113, 46, 47,
+    109, 126, 46, 65,
+    113, 126, 46, 73,
+    110, 113, 47, 48,
+    110, 112, 48, 49,
+    112, 113, 48, 52,
+    111, 112, 49, 50,
+    110, 111, 49, 67,
+    111, 114, 50, 65535,
+    112, 114, 50, 53,
+    113, 115, 51, 52,
+    113, 131, 51, 76,
+    115, 131, 51, 54,
+    112, 115, 52, 53,
+    114, 115, 53, 55,
+    116, 131, 54, 79,
+    115, 116, 54, 56,
+    115, 117, 55, 56,
+    114, 117, 55, 65535,
+    116, 117, 56, 58,
+    116, 120, 57, 58,
+    116, 118, 57, 82,
+    118, 120, 57, 60,
+    117, 120, 58, 59,
+    117, 119, 59, 65535,
+    119, 120, 59, 62,
+    120, 121, 60, 61,
+    118, 121, 60, 66,
+    120, 122, 61, 62,
+    121, 122, 61, 63,
+    119, 122, 62, 65535,
+    111, 121, 63, 67,
+    111, 122, 63, 65535,
+    125, 126, 64, 68,
+    118, 126, 64, 65,
+    118, 125, 64, 87,
+    109, 118, 65, 66,
+    124, 125, 68, 90,
+    124, 126, 68, 71,
+    123, 127, 69, 65535,
+    124, 127, 69, 70,
+    123, 124, 69, 89,
+    127, 128, 70, 72,
+    124, 128, 70, 71,
+    126, 128, 71, 73,
+    127, 129, 72, 65535,
+    128, 129, 72, 74,
+    113, 128, 73, 75,
+    129, 130, 74, 77,
+    128, 130, 74, 75,
+    113, 130, 75, 76,
+    130, 131, 76, 78,
+    129, 132, 77, 65535,
+    130, 132, 77, 80,
+    130, 133, 78, 80,
+    131, 133, 78, 79,
+    116, 133, 79, 81,
+    132, 133, 80, 83,
+    133, 134, 81, 85,
+    116, 134, 81, 82,
+    118, 134, 82, 87,
+    132, 136, 83, 65535,
+    133, 136, 83, 84,
+    133, 135, 84, 85,
+    135, 136, 84, 88,
+    134, 135, 85, 86,
+    125, 134, 86, 87,
+    125, 135, 86, 90,
+    123, 136, 88, 65535,
+    123, 135, 88, 89,
+    124, 135, 89, 90,
+    139, 143, 307, 318,
+    140, 143, 307, 311,
+    139, 140, 307, 313,
+    163, 168, 308, 102,
+    137, 163, 308, 283,
+    137, 168, 308, 314,
+    137, 141, 283, 284,
+    141, 163, 283, 105,
+    138, 142, 309, 310,
+    137, 138, 309, 316,
+    137, 142, 309, 285,
+    142, 143, 310, 286,
+    138, 143, 310, 317,
+    140, 144, 311, 65535,
+    143, 144, 311, 287,
+    141, 145, 284, 91,
+    137, 145, 284, 285,
+    142, 145, 285, 288,
+    143, 146, 286, 287,
+    142, 146, 286, 289,
+    144, 146, 287, 290,
+    145, 149, 288, 92,
+    142, 149, 288, 289,
+    146, 149, 289, 93,
+    144, 147, 290, 65535,
+    146, 147, 290, 93,
+    145, 148, 91, 92,
+    141, 148, 91, 105,
+    148, 149, 92, 94,
+    147, 149, 93, 95,
+    149, 150, 94, 95,
+    148, 150, 94, 292,
+    147, 150, 95, 96,
+    147, 152, 96, 65535,
+    150, 152, 96, 291,
+    150, 151, 291, 294,
+    151, 152, 291, 296,
+    148, 153, 292, 295,
+    150, 153, 292, 293,
+    150, 155, 293, 294,
+    153, 155, 293, 301,
+    151, 155, 294, 297,
+    148, 167, 295, 298,
+    153, 167, 295, 300,
+    151, 154, 296, 297,
+    152, 154, 296, 65535,
+    154, 155, 297, 299,
+    154, 156, 299, 302,
+    155, 156, 299, 301,
+    160, 167, 300, 306,
+    153, 160, 300, 303,
+    153, 156, 301, 304,
+    156, 159, 302, 305,
+    154, 159, 302, 65535,
+    153, 157, 303, 304,
+    157, 160, 303, 315,
+    156, 157, 304, 97,
+    156, 158, 305, 98,
+    158, 159, 305, 100,
+    157, 161, 97, 312,
+    156, 161, 97, 98,
+    158, 161, 98, 99,
+    139, 158, 99, 100,
+    139, 161, 99, 318,
+    139, 159, 100, 101,
+    159, 162, 101, 65535,
+    139, 162, 101, 313,
+    138, 161, 312, 317,
+    138, 157, 312, 316,
+    140, 162, 313, 65535,
+    137, 160, 314, 315,
+    160, 168, 314, 306,
+    137, 157, 315, 316,
+    143, 161, 317, 318,
+    168, 169, 102, 108,
+    163, 169, 102, 103,
+    165, 169, 103, 65535,
+    163, 165, 103, 104,
+    148, 163, 104, 105,
+    148, 165, 104, 298,
+    165, 167, 106, 298,
+    164, 165, 106, 65535,
+    164, 167, 106, 65535,
+    167, 168, 107, 306,
+    166, 167, 107, 65535,
+    166, 168, 107, 108,
+    166, 169, 108, 65535,
+    170, 173, 109, 111,
+    171, 173, 109, 110,
+    170, 171, 109, 116,
+    171, 172, 110, 319,
+    172, 173, 110, 112,
+    171, 174, 319, 320,
+    172, 174, 319, 112,
+    174, 180, 320, 326,
+    171, 180, 320, 322,
+    173, 185, 111, 136,
+    170, 185, 111, 123,
+    173, 174, 112, 120,
+    175, 176, 113, 321,
+    175, 179, 113, 119,
+    176, 179, 113, 114,
+    171, 175, 321, 322,
+    171, 176, 321, 116,
+    175, 180, 322, 324,
+    170, 179, 114, 115,
+    170, 176, 114, 116,
+    170, 192, 115, 123,
+    179, 192, 115, 134,
+    179, 182, 117, 130,
+    177, 179, 117, 118,
+    177, 182, 117, 122,
+    177, 178, 118, 323,
+    178, 179, 118, 119,
+    175, 177, 323, 324,
+    175, 178, 323, 119,
+    177, 180, 324, 326,
+    174, 181, 120, 325,
+    173, 181, 120, 121,
+    174, 177, 325, 326,
+    177, 181, 325, 122,
+    173, 182, 121, 136,
+    181, 182, 121, 122,
+    185, 192, 123, 335,
+    184, 187, 327, 328,
+    183, 184, 327, 129,
+    183, 187, 327, 124,
+    185, 187, 328, 330,
+    184, 185, 328, 335,
+    183, 186, 124, 65535,
+    186, 187, 124, 329,
+    187, 190, 329, 330,
+    186, 190, 329, 125,
+    185, 190, 330, 331,
+    186, 188, 125, 65535,
+    188, 190, 125, 340,
+    185, 189, 331, 342,
+    189, 190, 331, 341,
+    193, 201, 332, 135,
+    192, 193, 332, 333,
+    192, 201, 332, 339,
+    191, 194, 126, 65535,
+    193, 194, 126, 127,
+    191, 193, 126, 135,
+    193, 195, 127, 333,
+    194, 195, 127, 128,
+    192, 195, 333, 334,
+    183, 194, 128, 65535,
+    183, 195, 128, 129,
+    184, 195, 129, 334,
+    184, 192, 334, 335,
+    197, 200, 336, 337,
+    196, 197, 336, 138,
+    196, 200, 336, 131,
+    198, 200, 337, 338,
+    197, 198, 337, 345,
+    182, 198, 130, 139,
+    179, 198, 130, 134,
+    196, 199, 131, 65535,
+    199, 200, 131, 132,
+    200, 201, 132, 338,
+    199, 201, 132, 133,
+    198, 201, 338, 339,
+    191, 199, 133, 65535,
+    191, 201, 133, 135,
+    192, 198, 339, 134,
+    182, 185, 136, 342,
+    190, 203, 340, 341,
+    188, 203, 340, 137,
+    189, 203, 341, 344,
+    182, 189, 342, 139,
+    188, 202, 137, 65535,
+    202, 203, 137, 343,
+    197, 203, 343, 344,
+    197, 202, 343, 138,
+    189, 197, 344, 345,
+    196, 202, 138, 65535,
+    189, 198, 345, 139,
+};
+
+// Per-edge flags, parallel to teapot_decimated_edges
+static const uint8_t teapot_decimated_edge_flags[] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+    1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+    0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0,
+    1, 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+    1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0,
+    0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1,
+    0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0,
+    0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0,
+    1, 0, 1, 0, 0, 0,
+};
+
+static const TeapotMesh teapot_decimated_mesh = {
+    .name = "teapot_decimated",
+    .vertex_count = TEAPOT_DECIMATED_VERTEX_COUNT,
+    .triangle_count = TEAPOT_DECIMATED_TRIANGLE_COUNT,
+    .edge_count = TEAPOT_DECIMATED_EDGE_COUNT,
+    .cluster_count = TEAPOT_DECIMATED_CLUSTER_COUNT,
+    .vertices = teapot_decimated_vertices,
+    .vertex_scale = 9.845510795e-05f,
+    .bounds_min = {-3.191718f, -1.499964f, -2.011241f},
+    .bounds_max = {3.226079f, 1.501637f, 2.008681f},
+    .centroid = {-0.173452f, -0.105146f, -0.000773f},
+    .bounding_sphere = {0.017180f, 0.000837f, -0.001280f, 3.316612f},
+    .indices = teapot_decimated_indices,
+    .face_planes = teapot_decimated_face_planes,
+    .clusters = teapot_decimated_clusters,
+    .cluster_bounds = teapot_decimated_cluster_bounds,
+    .edges = teapot_decimated_edges,
+    .edge_flags = teapot_decimated_edge_flags,
+};
+
+// Level 1
+#define TEAPOT_DECIMATED_LOD1_VERTEX_COUNT 77
+#define TEAPOT_DECIMATED_LOD1_TRIANGLE_COUNT 120
+#define TEAPOT_DECIMATED_LOD1_EDGE_COUNT 195
+#define TEAPOT_DECIMATED_LOD1_CLUSTER_COUNT 5
+
+// Unique teapot vertices
+// Each vertex is 3 int16 (x, y, z), model position is
+// vertex * teapot_decimated_lod1_mesh.vertex_scale
+static const int16_t teapot_decimated_lod1_vertices[] = {
+    2539, 8345, 15188,
+    6563, 7904, 12122,
+    10166, 8475, 10413,
+    12898, 8382, 4971,
+    12181, 7705, -2863,
+    -16870, 7705, 2863,
+    -16192, 8455, 8492,
+    -11635, 8223, 12668,
+    -5462, 8177, 15506,
+    -7262, 8337, -15158,
+    -13634, 8306, -11454,
+    -17517, 8338, -4893,
+    11503, 8455, -8492,
+    6947, 8223, -12668,
+    771, 8183, -15517,
+    -2251, -3344, 20960,
+    7279, -3929, 19215,
+    16505, -10767, 10207,
+    15970, -3022, 10755,
+    18501, -3034, 48,
+    -23290, -3539, 4321,
+    -21366, -1609, -8863,
+    -19355, -3061, 12445,
+    -17581, -10776, 15160,
+    -12575, -2638, 18517,
+    -6680, -10921, 20888,
+    -2296, -3034, -20845,
+    -12092, -10927, -18969,
+    -12116, -3716, -19064,
+    -22118, -11123, -8535,
+    16555, -10786, -10098,
+    16352, -2909, -10025,
+    7862, -10767, -18849,
+    7886, -2638, -18517,
+    7152, -15839, 14547,
+    7662, -11114, 18662,
+    18690, -10744, 30,
+    -16310, -15839, 10011,
+    -22551, -10936, 6370,
+    -2314, -10744, -21034,
+    -11941, -15839, -14508,
+    12203, -15839, -9496,
+    -32767, 4851, 2440,
+    -30750, 3037, 12,
+    -19359, 3950, 36,
+    -18101, 6574, -515,
+    -32328, 4950, -2524,
+    -22150, -11163, -114,
+    -32543, -3947, 2367,
+    -23801, -8185, 94,
+    -31530, -3857, -2890,
+    15587, -11492, -1018,
+    29264, 7894, 1682,
+    23752, -7438, 3209,
+    15613, -7882, 5894,
+    21301, -1400, 2405,
+    22711, 1185, -2313,
+    15624, -1959, -139,
+    22495, -4104, -5083,
+    28750, 7946, -1552,
+    15604, -6727, -5622,
+    23429, -7826, -3046,
+    27342, 8173, 1632,
+    31643, 8142, -136,
+    -4600, 15390, 3196,
+    -6135, 15238, -2728,
+    2760, 15176, -919,
+    -3769, 11405, -741,
+    -734, 11367, -451,
+    5457, 7919, 13232,
+    10888, 7919, -7802,
+    9783, 8876, 7166,
+    -17689, 7924, 4628,
+    -2196, 10874, 1510,
+    -7538, 8808, 12793,
+    -10661, 7925, -13634,
+    5237, 9036, -11218,
+};
+
+// Teapot triangles as indices into teapot_decimated_lod1_vertices
+// Each triangle is 3 indices
+static const uint16_t teapot_decimated_lod1_indices[] = {
+    0, 2, 1,
+    11, 6, 5,
+    3, 12, 4,
+    35, 25, 34,
+    17, 35, 34,
+    34, 41, 17,
+    36, 17, 41,
+    38, 29, 37,
+    29, 38, 49,
+    23, 38, 37,
+    25, 23, 37,
+    37, 34, 25,
+    27, 39, 40,
+    29, 27, 40,
+    29, 40, 37,
+    30, 36, 41,
+    32, 30, 41,
+    41, 40, 32,
+    39, 32, 40,
+    44, 45, 42,
+    42, 43, 44,
+    43, 46, 44,
+    45, 44, 46,
+    50, 48, 46,
+    42, 46, 48,
+    46, 42, 45,
+    47, 49, 48,
+    48, 49, 42,
+    43, 42, 49,
+    49, 50, 43,
+    46, 43, 50,
+    49, 47, 50,
+    48, 50, 47,
+    61, 53, 51,
+    54, 51, 53,
+    52, 54, 53,
+    52, 62, 54,
+    55, 54, 62,
+    57, 54, 55,
+    62, 56, 55,
+    62, 59, 56,
+    55, 56, 57,
+    58, 57, 56,
+    58, 60, 57,
+    56, 59, 58,
+    59, 61, 58,
+    58, 61, 60,
+    51, 60, 61,
+    53, 61, 59,
+    63, 52, 59,
+    59, 52, 53,
+    63, 62, 52,
+    73, 68, 64,
+    66, 64, 68,
+    64, 65, 67,
+    67, 73, 64,
+    68, 67, 66,
+    65, 66, 67,
+    66, 65, 64,
+    71, 74, 69,
+    74, 71, 73,
+    69, 70, 71,
+    76, 73, 71,
+    72, 74, 73,
+    72, 69, 74,
+    67, 68, 75,
+    73, 75, 72,
+    75, 73, 67,
+    76, 71, 70,
+    68, 73, 76,
+    70, 75, 76,
+    76, 75, 68,
+    15, 16, 0,
+    38, 23, 20,
+    22, 20, 23,
+    24, 22, 23,
+    22, 24, 6,
+    7, 6, 24,
+    23, 25, 24,
+    24, 8, 7,
+    15, 24, 25,
+    24, 15, 8,
+    0, 8, 15,
+    25, 35, 15,
+    16, 15, 35,
+    16, 2, 0,
+    18, 16, 17,
+    16, 18, 2,
+    18, 3, 2,
+    17, 36, 18,
+    19, 18, 36,
+    18, 19, 3,
+    12, 3, 19,
+    36, 30, 19,
+    31, 19, 30,
+    19, 31, 12,
+    35, 17, 16,
+    21, 20, 11,
+    6, 11, 20,
+    20, 49, 38,
+    20, 22, 6,
+    28, 10, 9,
+    21, 28, 29,
+    28, 21, 10,
+    21, 11, 10,
+    20, 21, 29,
+    29, 49, 20,
+    27, 29, 28,
+    39, 27, 26,
+    28, 26, 27,
+    26, 28, 9,
+    30, 32, 31,
+    33, 31, 32,
+    31, 33, 12,
+    13, 12, 33,
+    33, 14, 13,
+    32, 39, 33,
+    26, 33, 39,
+    33, 26, 14,
+    9, 14, 26,
+};
+
+// Teapot triangle planes, parallel to teapot_decimated_lod1_indices
+// Each plane is 4 floats (normal x, y, z, offset), the unit normal
+// follows the winding and offset is dot(normal, vertex 1)
+static const float teapot_decimated_lod1_face_planes[] = {
+    -0.402233f, 0.669722f, -0.624244f, -0.465326f,
+    0.980956f, -0.169060f, -0.095628f, -1.716526f,
+    -0.986322f, -0.129874f, 0.101496f, -1.260102f,
+    0.106613f, -0.659528f, 0.744081f, 2.086610f,
+    0.579418f, -0.569941f, 0.582617f, 2.050027f,
+    0.512049f, -0.852194f, 0.107572f, 1.773330f,
+    0.511289f, -0.852616f, 0.107847f, 1.772837f,
+    -0.614873f, -0.788586f, -0.007969f, 2.125089f,
+    -0.892032f, -0.451518f, -0.020249f, 2.360507f,
+    -0.699180f, -0.588455f, 0.406038f, 2.347627f,
+    -0.334020f, -0.711995f, 0.617652f, 2.169529f,
+    -0.092193f, -0.874131f, 0.476859f, 1.905722f,
+    -0.141799f, -0.667897f, -0.730621f, 2.166065f,
+    -0.597451f, -0.549112f, -0.584404f, 2.302269f,
+    -0.458085f, -0.885153f, -0.081625f, 1.957930f,
+    0.739665f, -0.655304f, -0.153205f, 1.975563f,
+    0.582107f, -0.570390f, -0.579488f, 2.049465f,
+    0.106212f, -0.852603f, -0.511651f, 1.861803f,
+    0.107290f, -0.854254f, -0.508664f, 1.858957f,
+    0.182894f, 0.117285f, 0.976112f, -0.288112f,
+    0.060772f, -0.774763f, 0.629324f, -0.399098f,
+    0.063619f, -0.777286f, -0.625922f, -0.409541f,
+    0.165351f, -0.277971f, -0.946251f, -0.410360f,
+    -0.978470f, -0.080766f, -0.189929f, 3.003221f,
+    -0.995767f, -0.024618f, -0.088553f, 3.058267f,
+    -0.114754f, 0.993347f, 0.009662f, 0.814689f,
+    0.294080f, 0.096623f, 0.950884f, -0.729305f,
+    0.250895f, -0.001644f, 0.968013f, -0.555640f,
+    0.810897f, 0.504301f, 0.296861f, -2.216076f,
+    0.482653f, 0.292842f, -0.825403f, -1.322271f,
+    0.876660f, 0.099000f, -0.470814f, -2.525033f,
+    0.495324f, 0.330714f, -0.803295f, -1.379994f,
+    -0.585950f, -0.800395f, -0.126613f, 2.076678f,
+    0.430396f, -0.902010f, 0.033727f, 1.613775f,
+    0.196962f, -0.869329f, 0.453292f, 1.193171f,
+    0.314138f, -0.018400f, 0.949199f, 1.008055f,
+    0.010962f, 0.249071f, 0.968423f, 0.370849f,
+    -0.781964f, 0.459441f, -0.421244f, -1.734313f,
+    -0.358545f, 0.666465f, 0.653659f, -0.662776f,
+    -0.843456f, 0.535601f, 0.041385f, -1.763088f,
+    -0.679824f, 0.646250f, -0.346699f, -1.313715f,
+    -0.265958f, 0.876688f, 0.400856f, -0.561452f,
+    -0.434096f, 0.431806f, -0.790635f, -0.712018f,
+    -0.229786f, 0.734816f, -0.638156f, -0.467932f,
+    -0.390239f, 0.439622f, -0.808978f, -0.612793f,
+    0.725001f, -0.181662f, -0.664358f, 1.934938f,
+    0.229363f, -0.422372f, -0.876923f, 1.074926f,
+    0.137713f, -0.688487f, -0.712054f, 1.021243f,
+    0.947960f, -0.317039f, -0.029285f, 2.346782f,
+    0.081690f, -0.996236f, -0.029002f, -0.523004f,
+    0.925074f, -0.347773f, -0.152619f, 2.279468f,
+    0.129500f, 0.945598f, 0.298453f, 1.113366f,
+    0.766922f, 0.178077f, 0.616538f, 0.112056f,
+    0.455977f, -0.316045f, 0.831986f, -0.407455f,
+    -0.876794f, -0.417887f, 0.237913f, -0.155093f,
+    -0.743497f, -0.542021f, 0.391696f, -0.347541f,
+    0.090622f, -0.202922f, -0.974993f, -0.183102f,
+    0.183454f, -0.360791f, -0.914426f, -0.391002f,
+    0.012860f, 0.999497f, -0.028978f, 1.442393f,
+    0.060272f, 0.978478f, 0.197352f, 1.012278f,
+    0.064070f, 0.975812f, 0.209013f, 1.021470f,
+    0.326465f, -0.941443f, 0.084294f, -0.431700f,
+    0.181022f, 0.982812f, -0.036209f, 0.969289f,
+    -0.166485f, 0.980880f, 0.100783f, 1.059160f,
+    -0.073542f, -0.977587f, 0.197270f, -0.523956f,
+    0.038731f, 0.959324f, -0.279639f, 1.041967f,
+    -0.201514f, 0.976415f, -0.077498f, 1.036353f,
+    -0.818524f, -0.265792f, 0.509286f, -0.030658f,
+    0.220409f, 0.974321f, -0.046023f, 0.991983f,
+    0.795572f, -0.324714f, 0.511495f, -0.426705f,
+    0.136216f, -0.852782f, -0.504191f, -0.126559f,
+    -0.033182f, 0.972856f, -0.229020f, 1.059371f,
+    0.189240f, 0.371322f, 0.909015f, 1.646460f,
+    -0.869822f, 0.049086f, 0.490917f, 2.102974f,
+    -0.897541f, -0.052309f, 0.437817f, 2.176366f,
+    -0.667040f, 0.106128f, 0.737424f, 2.061044f,
+    -0.624787f, 0.401477f, 0.669670f, 1.818121f,
+    -0.601974f, 0.418376f, 0.680139f, 1.805089f,
+    -0.464543f, -0.078115f, 0.882098f, 2.119625f,
+    -0.366829f, 0.465506f, 0.805444f, 1.733020f,
+    -0.220841f, 0.119891f, 0.967913f, 1.930418f,
+    -0.188840f, 0.376686f, 0.906889f, 1.721139f,
+    0.026687f, 0.433788f, 0.900620f, 1.644665f,
+    0.151351f, -0.097816f, 0.983628f, 1.951216f,
+    0.175781f, -0.066226f, 0.982199f, 1.933167f,
+    0.472702f, 0.434148f, 0.766856f, 1.559795f,
+    0.697652f, -0.002500f, 0.716433f, 1.785581f,
+    0.636871f, 0.342063f, 0.690933f, 1.569069f,
+    0.812963f, 0.422332f, 0.400907f, 1.517020f,
+    0.976341f, 0.052602f, 0.209739f, 1.675219f,
+    0.972921f, 0.023313f, 0.229960f, 1.699024f,
+    0.910207f, 0.354117f, 0.214765f, 1.494022f,
+    0.878562f, 0.469360f, -0.088489f, 1.404084f,
+    0.978182f, 0.024460f, -0.206304f, 1.705930f,
+    0.977700f, 0.027127f, -0.208248f, 1.704310f,
+    0.894461f, 0.406726f, -0.185779f, 1.449495f,
+    0.691335f, -0.018740f, 0.722291f, 1.797931f,
+    -0.919003f, 0.386551f, -0.077527f, 1.865730f,
+    -0.869922f, 0.486348f, 0.081864f, 1.789251f,
+    -0.983484f, -0.050075f, 0.173932f, 2.257192f,
+    -0.845935f, 0.365610f, 0.388231f, 1.902180f,
+    -0.454125f, 0.434879f, -0.777593f, 1.771935f,
+    -0.736738f, 0.034952f, -0.675274f, 2.052228f,
+    -0.660561f, 0.340234f, -0.669254f, 1.846515f,
+    -0.757289f, 0.472832f, -0.450493f, 1.838414f,
+    -0.988323f, 0.073517f, -0.133468f, 2.100648f,
+    -0.881519f, 0.367099f, -0.296921f, 1.699791f,
+    -0.720908f, -0.011528f, -0.692935f, 2.082307f,
+    -0.207007f, 0.024458f, -0.978034f, 1.968730f,
+    -0.177525f, -0.013555f, -0.984023f, 1.985066f,
+    -0.190600f, 0.371258f, -0.908757f, 1.728756f,
+    0.709262f, 0.024808f, -0.704508f, 1.760399f,
+    0.708363f, 0.026716f, -0.705342f, 1.759274f,
+    0.663594f, 0.370803f, -0.649729f, 1.542350f,
+    0.602071f, 0.418306f, -0.680096f, 1.537787f,
+    0.368286f, 0.465303f, -0.804896f, 1.570301f,
+    0.209859f, 0.039280f, -0.976942f, 1.860121f,
+    0.221962f, 0.023377f, -0.974775f, 1.869333f,
+    0.192403f, 0.377618f, -0.905751f, 1.637715f,
+    -0.031839f, 0.435924f, -0.899420f, 1.657222f,
+};
+
+// Triangle clusters, each is 2 values (first triangle, triangle count)
+static const uint16_t teapot_decimated_lod1_clusters[] = {
+    0, 72,
+    72, 13,
+    85, 12,
+    97, 11,
+    108, 12,
+};
+
+// Cluster bounds, parallel to teapot_decimated_lod1_clusters
+// Each is 9 floats: bounding sphere center x, y, z and radius, normal
+// cone axis x, y, z, cosine and sine of the cone half-angle
+static const float teapot_decimated_lod1_cluster_bounds[] = {
+    -0.053224f, -0.021261f, -0.006913f, 3.151197f, 0.087864f, -0.954765f, -0.284082f, 0.000000f, 1.000000f,
+    -0.740019f, -0.125909f, 1.197109f, 1.825365f, -0.379137f, 0.212896f, 0.900517f, 0.723416f, 0.690412f,
+    1.005238f, -0.124962f, 0.431709f, 1.745534f, 0.922842f, 0.236307f, 0.304174f, 0.772079f, 0.635526f,
+    -1.470899f, -0.126335f, -0.313424f, 1.769414f, -0.900153f, 0.296085f, -0.319464f, 0.745697f, 0.666285f,
+    0.210196f, -0.117054f, -1.398119f, 1.690070f, 0.280767f, 0.234607f, -0.930661f, 0.857835f, 0.513926f,
+};
+
+// Unique teapot edges with their adjacent triangles
+// Each edge is 4 indices (vertex 1, vertex 2, face 1, face 2),
+// face 2 is TEAPOT_NO_FACE on open borders
+static const uint16_t teapot_decimated_lod1_edges[] = {
+    0, 2, 0, 85,
+    1, 2, 0, 65535,
+    0, 1, 0, 65535,
+    6, 11, 1, 98,
+    5, 6, 1, 65535,
+    5, 11, 1, 65535,
+    3, 12, 2, 92,
+    4, 12, 2, 65535,
+    3, 4, 2, 65535,
+    15, 16, 72, 84,
+    0, 16, 72, 85,
+    0, 15, 72, 82,
+    2, 16, 85, 87,
+    16, 18, 86, 87,
+    16, 17, 86, 96,
+    17, 18, 86, 89,
+    2, 18, 87, 88,
+    3, 18, 88, 91,
+    2, 3, 88, 65535,
+    17, 36, 89, 6,
+    18, 36, 89, 90,
+    18, 19, 90, 91,
+    19, 36, 90, 93,
+    3, 19, 91, 92,
+    20, 21, 97, 105,
+    11, 20, 97, 98,
+    11, 21, 97, 104,
+    6, 20, 98, 100,
+    20, 49, 99, 106,
+    38, 49, 99, 8,
+    20, 38, 99, 73,
+    23, 38, 73, 9,
+    20, 23, 73, 74,
+    20, 22, 74, 100,
+    22, 23, 74, 75,
+    6, 22, 100, 76,
+    22, 24, 75, 76,
+    23, 24, 75, 78,
+    6, 24, 76, 77,
+    6, 7, 77, 65535,
+    7, 24, 77, 79,
+    23, 25, 78, 10,
+    24, 25, 78, 80,
+    8, 24, 79, 81,
+    7, 8, 79, 65535,
+    15, 24, 80, 81,
+    15, 25, 80, 83,
+    8, 15, 81, 82,
+    0, 8, 82, 65535,
+    27, 39, 108, 12,
+    26, 27, 108, 109,
+    26, 39, 108, 117,
+    26, 28, 109, 110,
+    27, 28, 109, 107,
+    9, 28, 110, 101,
+    9, 26, 110, 119,
+    10, 28, 101, 103,
+    9, 10, 101, 65535,
+    21, 28, 102, 103,
+    28, 29, 102, 107,
+    21, 29, 102, 105,
+    10, 21, 103, 104,
+    10, 11, 104, 65535,
+    20, 29, 105, 106,
+    29, 49, 106, 8,
+    12, 19, 92, 95,
+    30, 36, 93, 15,
+    19, 30, 93, 94,
+    19, 31, 94, 95,
+    30, 31, 94, 111,
+    12, 31, 95, 113,
+    30, 32, 111, 16,
+    31, 32, 111, 112,
+    31, 33, 112, 113,
+    32, 33, 112, 116,
+    12, 33, 113, 114,
+    12, 13, 114, 65535,
+    13, 33, 114, 115,
+    14, 33, 115, 118,
+    13, 14, 115, 65535,
+    32, 39, 116, 18,
+    33, 39, 116, 117,
+    26, 33, 117, 118,
+    14, 26, 118, 119,
+    9, 14, 119, 65535,
+    25, 35, 3, 83,
+    25, 34, 3, 11,
+    34, 35, 3, 4,
+    15, 35, 83, 84,
+    16, 35, 84, 96,
+    17, 35, 4, 96,
+    17, 34, 4, 5,
+    34, 41, 5, 65535,
+    17, 41, 5, 6,
+    36, 41, 6, 15,
+    29, 38, 7, 8,
+    29, 37, 7, 14,
+    37, 38, 7, 9,
+    23, 37, 9, 10,
+    25, 37, 10, 11,
+    34, 37, 11, 65535,
+    39, 40, 12, 18,
+    27, 40, 12, 13,
+    27, 29, 13, 107,
+    29, 40, 13, 14,
+    37, 40, 14, 65535,
+    30, 41, 15, 16,
+    32, 41, 16, 17,
+    40, 41, 17, 65535,
+    32, 40, 17, 18,
+    44, 45, 19, 22,
+    42, 45, 19, 25,
+    42, 44, 19, 20,
+    42, 43, 20, 28,
+    43, 44, 20, 21,
+    43, 46, 21, 30,
+    44, 46, 21, 22,
+    45, 46, 22, 25,
+    48, 50, 23, 32,
+    46, 48, 23, 24,
+    46, 50, 23, 30,
+    42, 46, 24, 25,
+    42, 48, 24, 27,
+    47, 49, 26, 31,
+    48, 49, 26, 27,
+    47, 48, 26, 32,
+    42, 49, 27, 28,
+    43, 49, 28, 29,
+    49, 50, 29, 31,
+    43, 50, 29, 30,
+    47, 50, 31, 32,
+    53, 61, 33, 48,
+    51, 53, 33, 34,
+    51, 61, 33, 47,
+    51, 54, 34, 65535,
+    53, 54, 34, 35,
+    52, 54, 35, 36,
+    52, 53, 35, 50,
+    52, 62, 36, 51,
+    54, 62, 36, 37,
+    54, 55, 37, 38,
+    55, 62, 37, 39,
+    54, 57, 38, 65535,
+    55, 57, 38, 41,
+    56, 62, 39, 40,
+    55, 56, 39, 41,
+    59, 62, 40, 65535,
+    56, 59, 40, 44,
+    56, 57, 41, 42,
+    57, 58, 42, 43,
+    56, 58, 42, 44,
+    58, 60, 43, 46,
+    57, 60, 43, 65535,
+    58, 59, 44, 45,
+    59, 61, 45, 48,
+    58, 61, 45, 46,
+    60, 61, 46, 47,
+    51, 60, 47, 65535,
+    53, 59, 48, 50,
+    52, 63, 49, 51,
+    52, 59, 49, 50,
+    59, 63, 49, 65535,
+    62, 63, 51, 65535,
+    68, 73, 52, 69,
+    64, 68, 52, 53,
+    64, 73, 52, 55,
+    64, 66, 53, 58,
+    66, 68, 53, 56,
+    64, 65, 54, 58,
+    65, 67, 54, 57,
+    64, 67, 54, 55,
+    67, 73, 55, 67,
+    67, 68, 56, 65,
+    66, 67, 56, 57,
+    65, 66, 57, 58,
+    71, 74, 59, 60,
+    69, 74, 59, 64,
+    69, 71, 59, 61,
+    71, 73, 60, 62,
+    73, 74, 60, 63,
+    69, 70, 61, 65535,
+    70, 71, 61, 68,
+    73, 76, 62, 69,
+    71, 76, 62, 68,
+    72, 74, 63, 64,
+    72, 73, 63, 66,
+    69, 72, 64, 65535,
+    68, 75, 65, 71,
+    67, 75, 65, 67,
+    73, 75, 66, 67,
+    72, 75, 66, 65535,
+    70, 76, 68, 70,
+    68, 76, 69, 71,
+    70, 75, 70, 65535,
+    75, 76, 70, 71,
+};
+
+// Per-edge flags, parallel to teapot_decimated_lod1_edges
+static const uint8_t teapot_decimated_lod1_edge_flags[] = {
+    1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1,
+    0, 0, 1, 1, 0, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 1, 0,
+    1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+    1, 0, 1,
+};
+
+static const TeapotMesh teapot_decimated_lod1_mesh = {
+    .name = "teapot_decimated_lod1",
+    .vertex_count = TEAPOT_DECIMATED_LOD1_VERTEX_COUNT,
+    .triangle_count = TEAPOT_DECIMATED_LOD1_TRIANGLE_COUNT,
+    .edge_count = TEAPOT_DECIMATED_LOD1_EDGE_COUNT,
+    .cluster_count = TEAPOT_DECIMATED_LOD1_CLUSTER_COUNT,
+    .vertices = teapot_decimated_lod1_vertices,
+    .vertex_scale = 9.470426448e-05f,
+    .bounds_min = {-3.103175f, -1.500021f, -1.992010f},
+    .bounds_max = {2.996727f, 1.457499f, 1.985001f},
+    .centroid = {-0.160308f, -0.180872f, 0.010195f},
+    .bounding_sphere = {-0.053224f, -0.021261f, -0.003504f, 3.151207f},
+    .indices = teapot_decimated_lod1_indices,
+    .face_planes = teapot_decimated_lod1_face_planes,
+    .clusters = teapot_decimated_lod1_clusters,
+    .cluster_bounds = teapot_decimated_lod1_cluster_bounds,
+    .edges = teapot_decimated_lod1_edges,
+    .edge_flags = teapot_decimated_lod1_edge_flags,
+};
+
+// Levels of detail, finest first
+#define TEAPOT_DECIMATED_LEVEL_COUNT 2
+static const TeapotMesh* const teapot_decimated_levels[TEAPOT_DECIMATED_LEVEL_COUNT] = {
+    &teapot_decimated_mesh,
+    &teapot_decimated_lod1_mesh,
 };
 
 #endif // TEAPOT_DECIMATED_H
@@ -0,0 +1,1532 @@
+#include "teapot_engine.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* compiled-in meshes, one per level of detail */
+#include "teapot_lod.h"
+
+/* quarter-wave sine lookup table */
+#include "sin_table.h"
+
+// Projected coordinates are clamped to this range so that clipping math
+// stays inside 32-bit integers
+#define SCREEN_COORD_LIMIT 8191
+
+// Hidden-line depth buffer: one byte per pixel, 0 nearest, DEPTH_FAR where
+// no triangle was drawn
+#define DEPTH_FAR 255
+#define DEPTH_SHIFT 8 // Q8 depth while interpolating
+
+// Depth levels an edge pixel may lie behind the depth buffer and still be
+// drawn. Covers the rounding to 8 bits and the half pixel a triangle is
+// filled beyond its edges, so edges are not hidden by their own triangles.
+#ifndef DEPTH_BIAS
+#define DEPTH_BIAS 6
+#endif
+
+// Solid mode: faces are filled far to near with a 4x4 ordered dither of
+// 0..DITHER_LEVELS set (dark) pixels out of 16
+#define DITHER_LEVELS 16
+#define SORT_BUCKETS 256 // Painter's sort keys, the mean vertex depth
+#ifndef SHADE_AMBIENT
+#define SHADE_AMBIENT 64 // Brightness of faces turned away from the light, of 256
+#endif
+
+// Set to 0 to fill every face solid, so frames show only which pixels the
+// faces cover (make check_fixed compares that between builds)
+#ifndef SHADE_DITHER
+#define SHADE_DITHER 1
+#endif
+
+// Set to 1 to run the vertex pipeline in fixed point instead of float
+#ifndef TEAPOT_FIXED_POINT
+#define TEAPOT_FIXED_POINT 0
+#endif
+
+#if TEAPOT_FIXED_POINT
+#define MODEL_COORD_SHIFT 12 // Q3.12 model coordinates of the eye and planes, +-8 units
+#define ROTATION_SHIFT 14 // Q1.14 rotation coefficients
+#define STEP_SHIFT 32 // Q32 view units per quantized vertex step
+#define VIEW_SHIFT 16 // Q16.16 view space coordinates
+#define PROJECTION_SHIFT 14 // Q14 PROJECTION_DISTANCE / z reciprocal
+#define NORMAL_SHIFT 14 // Q1.14 unit face normals
+#endif
+
+#if TEAPOT_FIXED_POINT
+// Q16.16 view space position
+typedef struct {
+    int32_t x, y, z;
+} Vec3q;
+
+// Fixed-point model transform of quantized vertices:
+// view = (v * rotation) * step + translation
+typedef struct {
+    int16_t rotation[3][3]; // Q1.14, same layout as Matrix4x4
+    int32_t step; // Q32, vertex_scale times the camera scale
+    Vec3q translation; // Q16.16
+    int32_t eye[3]; // Q3.12 camera position in model space
+    Vec3f cluster_eye; // The same eye in float for the per-cluster test
+} FixedTransform;
+
+// Face plane for model space culling: a face is turned towards the eye when
+// dot(normal, eye) > offset
+typedef struct {
+    int16_t normal[3]; // Q1.14
+    int32_t offset; // Q3.26, normal times model coordinate
+} FixedPlane;
+#endif
+
+// Unit direction to the light in view space (x right, y up, z away from the
+// viewer): above, left of and behind the viewer
+static const Vec3f light_direction = {-0.408248f, 0.408248f, -0.816497f};
+
+// Transformed vertex, shared by every triangle that references it
+typedef struct {
+#if TEAPOT_FIXED_POINT
+    Vec3q view; // View space position
+#else
+    Vec3f view; // View space position
+#endif
+    int16_t x, y; // Projected screen position, valid only when in_front
+    bool in_front; // Far enough from the camera (z >= 1) to be projected
+    uint8_t depth; // Quantized view z, only for hidden-line and solid frames
+} CachedVertex;
+
+// Everything a frame needs from the camera, built once in the setup stage
+typedef struct {
+    uint8_t lod;
+    const TeapotMesh* mesh;
+#if TEAPOT_FIXED_POINT
+    FixedTransform transform; // Includes the model space eye
+    const FixedPlane* planes;
+#else
+    Matrix4x4 transform;
+    Vec3f eye; // Camera position in model space
+    const float* planes;
+#endif
+    int center_x, center_y; // Screen position of the view axis
+    bool outside; // The bounding sphere misses the view, nothing to draw
+    uint8_t* depth; // Depth buffer of a hidden-line frame, otherwise NULL
+    bool vertex_depth; // Vertices get a depth, for the depth buffer or the painter's sort
+#if TEAPOT_FIXED_POINT
+    int32_t depth_near; // Q16.16 view z of depth 0
+    int32_t depth_scale; // Q8 depth levels per view unit
+    int16_t light[3]; // Q1.14 direction to the light in model space
+#else
+    float depth_near; // View z of depth 0
+    float depth_scale; // Depth levels per view unit
+    Vec3f light; // Direction to the light in model space
+#endif
+} FrameSetup;
+
+// Render passes in frame order, each can be split into slices
+typedef enum {
+    RenderPhaseCull, // Cluster and face backface culling, by cluster
+    RenderPhaseTransform, // Needed vertices, by vertex
+    RenderPhaseScreen, // Near plane and screen bounds, by triangle
+    RenderPhaseDepth, // Depth buffer fill for hidden lines, by triangle
+    RenderPhaseEdges, // Line drawing, by edge
+    RenderPhaseSort, // Painter's order of the solid faces, in one go
+    RenderPhaseFill, // Solid face filling, by sorted face
+    RenderPhaseDone
+} RenderPhase;
+
+// One frame in progress
+typedef struct {
+    RenderBuffer* rb;
+    RenderMode mode;
+    FrameSetup setup;
+    RenderPhase phase;
+    int next; // Next cluster, vertex, triangle or edge of the phase
+    int sorted; // Faces in face_order
+    RenderStats stats;
+} RenderJob;
+
+// The frame started by render_model_begin()
+static RenderJob sliced_job = {.phase = RenderPhaseDone};
+
+// Per-frame vertex cache, one entry per unique model vertex, sized for the
+// largest level
+static CachedVertex* vertex_cache = NULL;
+
+// Per-frame backface culling result, one entry per triangle
+static bool* face_front = NULL;
+
+// Per-frame front faces that survived the near plane and screen bounds, the
+// ones drawn. Kept apart from face_front, so clipping a front face does not
+// turn its edges into silhouettes.
+static bool* face_visible = NULL;
+
+// Per-frame flag for vertices used by a front-facing triangle, the only
+// ones transformed
+static bool* vertex_needed = NULL;
+
+// Nearest depth per pixel of a hidden-line frame, row by row
+static uint8_t* depth_buffer = NULL;
+static size_t depth_buffer_size = 0;
+
+// Visible faces of a solid frame, far to near
+static uint16_t* face_order = NULL;
+
+// Per-key face counts, then first positions, of the painter's sort
+static uint16_t sort_counts[SORT_BUCKETS];
+
+// Dither byte for each number of dark pixels out of 16 and row modulo 4,
+// built from the 4x4 Bayer matrix
+static uint8_t dither_patterns[DITHER_LEVELS + 1][4];
+
+#if TEAPOT_FIXED_POINT
+// Face planes of each level converted once to fixed point
+static FixedPlane* fixed_planes[TEAPOT_LOD_MAX] = {NULL};
+#endif
+
+const char* render_mode_names[RenderModeCount] = {"WIRE", "SIL", "HIDE", "FILL"};
+
+// Function prototypes
+static void init_identity_matrix(Matrix4x4* m);
+static void rotate_x_matrix(Matrix4x4* m, float angle);
+static void rotate_y_matrix(Matrix4x4* m, float angle);
+static void rotate_z_matrix(Matrix4x4* m, float angle);
+static void multiply_matrices(Matrix4x4* a, Matrix4x4* b, Matrix4x4* out);
+static void build_rotation_matrix(Matrix4x4* m, const TeapotCamera* camera);
+static void transform_point(Matrix4x4* m, Vec3f* in, Vec3f* out);
+#if !TEAPOT_FIXED_POINT
+static void build_model_matrix(Matrix4x4* m, const Matrix4x4* rotation, const TeapotCamera* camera);
+static void model_space_eye(Matrix4x4* m, float scale, Vec3f* eye);
+#endif
+
+// Set pixels x0..x1 (inclusive, either order) of one buffer row.
+// Pixels are packed LSB first, as canvas_draw_xbm expects.
+static void buffer_draw_span(uint8_t* row, int x0, int x1) {
+    if(x0 > x1) {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    int first = x0 >> 3;
+    int last = x1 >> 3;
+    uint8_t head = 0xFF << (x0 & 7);
+    uint8_t tail = 0xFF >> (7 - (x1 & 7));
+    
+    if(first == last) {
+        row[first] |= head & tail;
+        return;
+    }
+    row[first] |= head;
+    for(int i = first + 1; i < last; i++) {
+        row[i] = 0xFF;
+    }
+    row[last] |= tail;
+}
+
+// Replace pixels x0..x1 (inclusive, x0 <= x1) of one buffer row with a
+// pattern byte. Whole bytes in between are stored 32 bits at a time.
+static void buffer_fill_span(uint8_t* row, int x0, int x1, uint8_t pattern) {
+    int first = x0 >> 3;
+    int last = x1 >> 3;
+    uint8_t head = 0xFF << (x0 & 7);
+    uint8_t tail = 0xFF >> (7 - (x1 & 7));
+    
+    if(first == last) {
+        uint8_t mask = head & tail;
+        row[first] = (row[first] & ~mask) | (pattern & mask);
+        return;
+    }
+    row[first] = (row[first] & ~head) | (pattern & head);
+    int i = first + 1;
+    for(; i < last && (i & 3); i++) {
+        row[i] = pattern;
+    }
+    uint32_t word = pattern * 0x01010101u;
+    for(; i + 4 <= last; i += 4) {
+        memcpy(&row[i], &word, sizeof(word));
+    }
+    for(; i < last; i++) {
+        row[i] = pattern;
+    }
+    row[last] = (row[last] & ~tail) | (pattern & tail);
+}
+
+// Cohen-Sutherland outcode bits
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+static uint8_t clip_outcode(RenderBuffer* rb, int x, int y) {
+    uint8_t code = 0;
+    if(x < 0) code |= CLIP_LEFT;
+    else if(x >= rb->width) code |= CLIP_RIGHT;
+    if(y < 0) code |= CLIP_TOP;
+    else if(y >= rb->height) code |= CLIP_BOTTOM;
+    return code;
+}
+
+// Clip a line to the render buffer (Cohen-Sutherland).
+// Returns false when no part of the line is visible. Forced inline, as a
+// call per line costs more than the clipping once both line drawers use it.
+static inline __attribute__((always_inline)) bool clip_line(RenderBuffer* rb, int* x0, int* y0, int* x1, int* y1) {
+    int x_max = rb->width - 1;
+    int y_max = rb->height - 1;
+    uint8_t code0 = clip_outcode(rb, *x0, *y0);
+    uint8_t code1 = clip_outcode(rb, *x1, *y1);
+    
+    while(true) {
+        if(!(code0 | code1)) return true;
+        if(code0 & code1) return false;
+        
+        // Move the outside endpoint onto the buffer edge it crosses
+        uint8_t code = code0 ? code0 : code1;
+        int x, y;
+        if(code & CLIP_BOTTOM) {
+            x = *x0 + (*x1 - *x0) * (y_max - *y0) / (*y1 - *y0);
+            y = y_max;
+        } else if(code & CLIP_TOP) {
+            x = *x0 + (*x1 - *x0) * (0 - *y0) / (*y1 - *y0);
+            y = 0;
+        } else if(code & CLIP_RIGHT) {
+            y = *y0 + (*y1 - *y0) * (x_max - *x0) / (*x1 - *x0);
+            x = x_max;
+        } else {
+            y = *y0 + (*y1 - *y0) * (0 - *x0) / (*x1 - *x0);
+            x = 0;
+        }
+        
+        if(code == code0) {
+            *x0 = x;
+            *y0 = y;
+            code0 = clip_outcode(rb, x, y);
+        } else {
+            *x1 = x;
+            *y1 = y;
+            code1 = clip_outcode(rb, x, y);
+        }
+    }
+}
+
+// Draw line to our buffer (Bresenham's line algorithm), clipped first so
+// only the visible part is stepped
+void buffer_draw_line(RenderBuffer* rb, int16_t line_x0, int16_t line_y0, int16_t line_x1, int16_t line_y1) {
+    int x0 = line_x0, y0 = line_y0, x1 = line_x1, y1 = line_y1;
+    if(!clip_line(rb, &x0, &y0, &x1, &y1)) return;
+    
+    int dx = abs(x1 - x0);
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0);
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    
+    // The line is clipped, so pixels go straight into the buffer with no
+    // bounds checks, stepping a row pointer instead of recomputing offsets
+    int stride = rb->width / 8;
+    int row_step = sy * stride;
+    uint8_t* row = rb->buffer + y0 * stride;
+    
+    if(dx > -4 * dy) {
+        // Shallow: work out how many pixels Bresenham puts on each row and
+        // write the whole run as byte masks
+        int remaining = dx + 1;
+        while(remaining > 0) {
+            int run = remaining;
+            if(dy != 0) {
+                // Pixels until 2 * err drops to dx, where the row changes
+                int excess = 2 * err - dx;
+                if(excess <= 0) {
+                    run = 1;
+                } else {
+                    run = (excess - 2 * dy - 1) / (-2 * dy) + 1;
+                }
+                if(run > remaining) run = remaining;
+            }
+            
+            buffer_draw_span(row, x0, x0 + sx * (run - 1));
+            remaining -= run;
+            x0 += sx * run;
+            err += run * dy + dx;
+            row += row_step;
+        }
+    } else if(dx >= -dy) {
+        // Diagonal-ish runs are too short to pay for the divide above,
+        // step every column and move the row pointer without branching
+        for(int i = dx; i >= 0; i--) {
+            row[x0 >> 3] |= 1 << (x0 & 7);
+            int step = -(2 * err <= dx); // All ones when the row changes
+            err += dy + (dx & step);
+            row += row_step & step;
+            x0 += sx;
+        }
+    } else {
+        // Mostly vertical: one bit per row, column steps without branching
+        for(int i = -dy; i >= 0; i--) {
+            row[x0 >> 3] |= 1 << (x0 & 7);
+            int step = -(2 * err >= dy); // All ones when the column changes
+            err += dx + (dy & step);
+            x0 += sx & step;
+            row += row_step;
+        }
+    }
+}
+
+// Draw a line with end depths z0 and z1 (0..DEPTH_FAR), leaving out the
+// pixels that lie more than DEPTH_BIAS behind the depth buffer. One pixel
+// at a time, as every pixel needs its own test.
+static void buffer_draw_line_depth(
+    RenderBuffer* rb,
+    const uint8_t* depth,
+    int x0,
+    int y0,
+    int z0,
+    int x1,
+    int y1,
+    int z1) {
+    // Depths of the clipped ends, interpolated along the major axis
+    bool major_x = abs(x1 - x0) >= abs(y1 - y0);
+    int from = major_x ? x0 : y0;
+    int length = major_x ? x1 - x0 : y1 - y0;
+    if(!clip_line(rb, &x0, &y0, &x1, &y1)) return;
+    if(length != 0) {
+        int dz = z1 - z0;
+        int start = z0;
+        z0 = start + dz * ((major_x ? x0 : y0) - from) / length;
+        z1 = start + dz * ((major_x ? x1 : y1) - from) / length;
+    }
+    
+    int dx = abs(x1 - x0);
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0);
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int steps = dx > -dy ? dx : -dy;
+    
+    // Q16 depth stepped once per pixel, biased so the test is one compare
+    int32_t z = (z0 - DEPTH_BIAS) * 65536 + (1 << 15);
+    int32_t z_step = steps ? (z1 - z0) * 65536 / steps : 0;
+    
+    int stride = rb->width / 8;
+    uint8_t* row = rb->buffer + y0 * stride;
+    const uint8_t* depth_row = depth + y0 * rb->width;
+    for(int i = steps; i >= 0; i--) {
+        if((z >> 16) <= depth_row[x0]) {
+            row[x0 >> 3] |= 1 << (x0 & 7);
+        }
+        z += z_step;
+        int e2 = 2 * err;
+        if(e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if(e2 <= dx) {
+            err += dx;
+            row += sy * stride;
+            depth_row += sy * rb->width;
+        }
+    }
+}
+
+static bool vec3f_equal(const Vec3f* a, const Vec3f* b) {
+    return a->x == b->x && a->y == b->y && a->z == b->z;
+}
+
+bool render_key_changed(const RenderKey* key, const TeapotCamera* camera, RenderMode mode, uint8_t lod) {
+    return !key->valid || key->mode != mode || key->lod != lod || key->camera.scale != camera->scale ||
+           !vec3f_equal(&key->camera.rotation, &camera->rotation) ||
+           !vec3f_equal(&key->camera.position, &camera->position);
+}
+
+void render_key_set(RenderKey* key, const TeapotCamera* camera, RenderMode mode, uint8_t lod) {
+    key->camera = *camera;
+    key->mode = mode;
+    key->lod = lod;
+    key->valid = true;
+}
+
+void render_key_invalidate(RenderKey* key) {
+    key->valid = false;
+}
+
+bool render_buffer_init(RenderBuffer* rb, uint16_t width, uint16_t height) {
+    rb->width = width;
+    rb->height = height;
+    size_t buffer_size = (rb->width / 8) * rb->height;
+    rb->buffer = malloc(buffer_size);
+    if(!rb->buffer) return false;
+    memset(rb->buffer, 0, buffer_size);
+    return true;
+}
+
+void render_buffer_clear(RenderBuffer* rb) {
+    if(rb->buffer) {
+        size_t buffer_size = (rb->width / 8) * rb->height;
+        memset(rb->buffer, 0, buffer_size);
+    }
+}
+
+void render_buffer_free(RenderBuffer* rb) {
+    if(rb->buffer) {
+        free(rb->buffer);
+        rb->buffer = NULL;
+    }
+}
+
+bool triple_buffer_init(TripleBuffer* tb, uint16_t width, uint16_t height) {
+    bool ok = true;
+    for(int i = 0; i < 3; i++) {
+        ok = render_buffer_init(&tb->buffers[i], width, height) && ok;
+    }
+    tb->back = 0;
+    tb->front = 1;
+    atomic_init(&tb->spare, 2);
+    return ok;
+}
+
+void triple_buffer_free(TripleBuffer* tb) {
+    for(int i = 0; i < 3; i++) {
+        render_buffer_free(&tb->buffers[i]);
+    }
+}
+
+RenderBuffer* triple_buffer_back(TripleBuffer* tb) {
+    return &tb->buffers[tb->back];
+}
+
+void triple_buffer_publish(TripleBuffer* tb) {
+    // Release ordering makes the frame contents visible before the index
+    uint_fast8_t old = atomic_exchange_explicit(
+        &tb->spare, tb->back | TRIPLE_BUFFER_FRESH, memory_order_acq_rel);
+    tb->back = old & ~TRIPLE_BUFFER_FRESH;
+}
+
+RenderBuffer* triple_buffer_front(TripleBuffer* tb) {
+    if(atomic_load_explicit(&tb->spare, memory_order_relaxed) & TRIPLE_BUFFER_FRESH) {
+        uint_fast8_t old = atomic_exchange_explicit(&tb->spare, tb->front, memory_order_acq_rel);
+        tb->front = old & ~TRIPLE_BUFFER_FRESH;
+    }
+    return &tb->buffers[tb->front];
+}
+
+bool teapot_engine_init(uint16_t width, uint16_t height) {
+    int max_vertices = 0, max_triangles = 0;
+    for(int lod = 0; lod < teapot_lod_count; lod++) {
+        const TeapotMesh* mesh = teapot_lods[lod];
+        if(mesh->vertex_count > max_vertices) max_vertices = mesh->vertex_count;
+        if(mesh->triangle_count > max_triangles) max_triangles = mesh->triangle_count;
+    }
+    
+    vertex_cache = malloc(sizeof(CachedVertex) * max_vertices);
+    face_front = malloc(sizeof(bool) * max_triangles);
+    face_visible = malloc(sizeof(bool) * max_triangles);
+    vertex_needed = malloc(sizeof(bool) * max_vertices);
+    depth_buffer_size = (size_t)width * height;
+    depth_buffer = malloc(depth_buffer_size);
+    face_order = malloc(sizeof(uint16_t) * max_triangles);
+    if(!vertex_cache || !face_front || !face_visible || !vertex_needed || !depth_buffer || !face_order) return false;
+    
+    // A pixel is dark when its threshold is below the level, the 4 pixel
+    // pattern repeats twice per byte
+    static const uint8_t bayer[4][4] = {
+        {0, 8, 2, 10},
+        {12, 4, 14, 6},
+        {3, 11, 1, 9},
+        {15, 7, 13, 5},
+    };
+    for(int level = 0; level <= DITHER_LEVELS; level++) {
+        for(int y = 0; y < 4; y++) {
+            uint8_t pattern = 0;
+            for(int x = 0; x < 8; x++) {
+                if(bayer[y][x & 3] < level) pattern |= 1 << x;
+            }
+            dither_patterns[level][y] = SHADE_DITHER ? pattern : 0xFF;
+        }
+    }
+    
+#if TEAPOT_FIXED_POINT
+    for(int lod = 0; lod < teapot_lod_count; lod++) {
+        const TeapotMesh* mesh = teapot_lods[lod];
+        fixed_planes[lod] = malloc(sizeof(FixedPlane) * mesh->triangle_count);
+        if(!fixed_planes[lod]) return false;
+        for(int i = 0; i < mesh->triangle_count; i++) {
+            const float* plane = &mesh->face_planes[i * 4];
+            for(int j = 0; j < 3; j++) {
+                float n = plane[j] * (1 << NORMAL_SHIFT);
+                fixed_planes[lod][i].normal[j] = (int16_t)(n < 0 ? n - 0.5f : n + 0.5f);
+            }
+            float offset = plane[3] * (1 << (NORMAL_SHIFT + MODEL_COORD_SHIFT));
+            fixed_planes[lod][i].offset = (int32_t)(offset < 0 ? offset - 0.5f : offset + 0.5f);
+        }
+    }
+#endif
+    return true;
+}
+
+void teapot_engine_free(void) {
+    if(vertex_cache) {
+        free(vertex_cache);
+        vertex_cache = NULL;
+    }
+    if(face_front) {
+        free(face_front);
+        face_front = NULL;
+    }
+    if(face_visible) {
+        free(face_visible);
+        face_visible = NULL;
+    }
+    if(vertex_needed) {
+        free(vertex_needed);
+        vertex_needed = NULL;
+    }
+    if(depth_buffer) {
+        free(depth_buffer);
+        depth_buffer = NULL;
+    }
+    if(face_order) {
+        free(face_order);
+        face_order = NULL;
+    }
+#if TEAPOT_FIXED_POINT
+    for(int lod = 0; lod < TEAPOT_LOD_MAX; lod++) {
+        if(fixed_planes[lod]) {
+            free(fixed_planes[lod]);
+            fixed_planes[lod] = NULL;
+        }
+    }
+#endif
+}
+
+// Simple 3D math functions
+static void init_identity_matrix(Matrix4x4* m) {
+    for(int i = 0; i < 4; i++) {
+        for(int j = 0; j < 4; j++) {
+            m->m[i][j] = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+}
+
+// Quantize an angle in radians to sin_table steps, wrapped to one circle
+static int angle_to_steps(float angle) {
+    float steps = angle * (SIN_TABLE_STEPS / 6.28318531f);
+    return (int32_t)(steps < 0 ? steps - 0.5f : steps + 0.5f) & (SIN_TABLE_STEPS - 1);
+}
+
+// Sine of a quantized angle in Q1.14, unfolded from the quarter-wave table
+static int32_t sin_steps(int steps) {
+    steps &= SIN_TABLE_STEPS - 1;
+    int quarter = SIN_TABLE_STEPS / 4;
+    if(steps < quarter) return sin_table[steps];
+    if(steps < 2 * quarter) return sin_table[2 * quarter - steps];
+    if(steps < 3 * quarter) return -sin_table[steps - 2 * quarter];
+    return -sin_table[4 * quarter - steps];
+}
+
+// Table sine/cosine, keeps libm out of the per-frame matrix setup
+static void sin_cos(float angle, float* s, float* c) {
+    int steps = angle_to_steps(angle);
+    *s = sin_steps(steps) * (1.0f / (1 << SIN_TABLE_SHIFT));
+    *c = sin_steps(steps + SIN_TABLE_STEPS / 4) * (1.0f / (1 << SIN_TABLE_SHIFT));
+}
+
+static void rotate_x_matrix(Matrix4x4* m, float angle) {
+    float s, c;
+    sin_cos(angle, &s, &c);
+    m->m[1][1] = c;
+    m->m[1][2] = -s;
+    m->m[2][1] = s;
+    m->m[2][2] = c;
+}
+
+static void rotate_y_matrix(Matrix4x4* m, float angle) {
+    float s, c;
+    sin_cos(angle, &s, &c);
+    m->m[0][0] = c;
+    m->m[0][2] = s;
+    m->m[2][0] = -s;
+    m->m[2][2] = c;
+}
+
+static void rotate_z_matrix(Matrix4x4* m, float angle) {
+    float s, c;
+    sin_cos(angle, &s, &c);
+    m->m[0][0] = c;
+    m->m[0][1] = -s;
+    m->m[1][0] = s;
+    m->m[1][1] = c;
+}
+
+// out = a * b, so a point transformed by out is transformed by a, then by b
+static void multiply_matrices(Matrix4x4* a, Matrix4x4* b, Matrix4x4* out) {
+    for(int i = 0; i < 4; i++) {
+        for(int j = 0; j < 4; j++) {
+            out->m[i][j] = a->m[i][0] * b->m[0][j] + a->m[i][1] * b->m[1][j] +
+                           a->m[i][2] * b->m[2][j] + a->m[i][3] * b->m[3][j];
+        }
+    }
+}
+
+// Combined X, Y and Z rotation for the camera's model rotation
+static void build_rotation_matrix(Matrix4x4* m, const TeapotCamera* camera) {
+    Matrix4x4 rot_x_matrix, rot_y_matrix, rot_z_matrix, rot_xy_matrix;
+    
+    init_identity_matrix(&rot_x_matrix);
+    init_identity_matrix(&rot_y_matrix);
+    init_identity_matrix(&rot_z_matrix);
+    
+    rotate_x_matrix(&rot_x_matrix, camera->rotation.x);
+    rotate_y_matrix(&rot_y_matrix, camera->rotation.y);
+    rotate_z_matrix(&rot_z_matrix, camera->rotation.z);
+    
+    // Note: order is important for proper 3D perspective!
+    // X and Y rotations first, then Z rotation
+    multiply_matrices(&rot_x_matrix, &rot_y_matrix, &rot_xy_matrix);
+    multiply_matrices(&rot_xy_matrix, &rot_z_matrix, m);
+}
+
+// Affine transform, model matrices never need the w divide
+static void transform_point(Matrix4x4* m, Vec3f* in, Vec3f* out) {
+    out->x = in->x * m->m[0][0] + in->y * m->m[1][0] + in->z * m->m[2][0] + m->m[3][0];
+    out->y = in->x * m->m[0][1] + in->y * m->m[1][1] + in->z * m->m[2][1] + m->m[3][1];
+    out->z = in->x * m->m[0][2] + in->y * m->m[1][2] + in->z * m->m[2][2] + m->m[3][2];
+}
+
+#if !TEAPOT_FIXED_POINT
+// Compose X/Y/Z rotation, scale and position into one affine matrix. Meshes
+// are centered on the origin, so they turn around their own center. Only the
+// upper 3x3 and the translation row are used, so each vertex costs 9
+// multiply-adds and no divide.
+static void build_model_matrix(Matrix4x4* m, const Matrix4x4* rotation, const TeapotCamera* camera) {
+    *m = *rotation;
+    
+    for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+            m->m[i][j] *= camera->scale;
+        }
+    }
+    m->m[3][0] = camera->position.x;
+    m->m[3][1] = camera->position.y;
+    m->m[3][2] = camera->position.z;
+}
+
+// The view space origin (the eye) taken back into model space:
+// eye = -translation * inverse(rotation * scale), where the inverse of a
+// scaled rotation is its transpose over scale squared
+static void model_space_eye(Matrix4x4* m, float scale, Vec3f* eye) {
+    float inv_scale_sq = 1.0f / (scale * scale);
+    eye->x = -(m->m[3][0] * m->m[0][0] + m->m[3][1] * m->m[0][1] + m->m[3][2] * m->m[0][2]) * inv_scale_sq;
+    eye->y = -(m->m[3][0] * m->m[1][0] + m->m[3][1] * m->m[1][1] + m->m[3][2] * m->m[1][2]) * inv_scale_sq;
+    eye->z = -(m->m[3][0] * m->m[2][0] + m->m[3][1] * m->m[2][1] + m->m[3][2] * m->m[2][2]) * inv_scale_sq;
+}
+
+// Fold the dequantization v * vertex_scale into the model matrix, so
+// quantized vertices go through the same 9 multiply-adds
+static void fold_quantization(Matrix4x4* m, const TeapotMesh* mesh) {
+    for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+            m->m[i][j] *= mesh->vertex_scale;
+        }
+    }
+}
+#endif
+
+static int16_t clamp_screen_coord(int v) {
+    if(v < -SCREEN_COORD_LIMIT) return -SCREEN_COORD_LIMIT;
+    if(v > SCREEN_COORD_LIMIT) return SCREEN_COORD_LIMIT;
+    return (int16_t)v;
+}
+
+#if TEAPOT_FIXED_POINT
+static int32_t float_to_fixed(float v, int shift) {
+    v *= (float)(1 << shift);
+    return (int32_t)(v < 0 ? v - 0.5f : v + 0.5f);
+}
+
+static void build_fixed_transform(
+    FixedTransform* f,
+    const TeapotMesh* mesh,
+    const Matrix4x4* rotation,
+    const TeapotCamera* camera) {
+    const Matrix4x4 rot = *rotation;
+    for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+            f->rotation[i][j] = (int16_t)float_to_fixed(rot.m[i][j], ROTATION_SHIFT);
+        }
+    }
+    // One quantization step in view units, too small for float_to_fixed
+    f->step = (int32_t)(mesh->vertex_scale * camera->scale * 4294967296.0f + 0.5f);
+    
+    // The centered mesh turns around the origin, then moves to the position
+    Vec3f t = camera->position;
+    f->translation.x = float_to_fixed(t.x, VIEW_SHIFT);
+    f->translation.y = float_to_fixed(t.y, VIEW_SHIFT);
+    f->translation.z = float_to_fixed(t.z, VIEW_SHIFT);
+    
+    // Eye in model space: -translation * transpose(rotation) / scale
+    for(int i = 0; i < 3; i++) {
+        float eye = -(t.x * rot.m[i][0] + t.y * rot.m[i][1] + t.z * rot.m[i][2]) / camera->scale;
+        f->eye[i] = float_to_fixed(eye, MODEL_COORD_SHIFT);
+    }
+    f->cluster_eye.x = -(t.x * rot.m[0][0] + t.y * rot.m[0][1] + t.z * rot.m[0][2]) / camera->scale;
+    f->cluster_eye.y = -(t.x * rot.m[1][0] + t.y * rot.m[1][1] + t.z * rot.m[1][2]) / camera->scale;
+    f->cluster_eye.z = -(t.x * rot.m[2][0] + t.y * rot.m[2][1] + t.z * rot.m[2][2]) / camera->scale;
+}
+
+// Model space backface test, the face is turned towards the eye when the
+// eye lies on the front side of its plane
+static bool face_faces_eye(const FixedPlane* planes, int face, const FixedTransform* f) {
+    const FixedPlane* plane = &planes[face];
+    int64_t d = (int64_t)plane->normal[0] * f->eye[0] + (int64_t)plane->normal[1] * f->eye[1] +
+                (int64_t)plane->normal[2] * f->eye[2];
+    return d > plane->offset;
+}
+
+// Scale a Q16.16 coordinate by a Q14 reciprocal, truncating toward zero like
+// the float path's int cast
+static int project_fixed(int32_t v, int32_t inv_z) {
+    int64_t p = (int64_t)v * inv_z;
+    return p >= 0 ? (int)(p >> (VIEW_SHIFT + PROJECTION_SHIFT)) :
+                    -(int)((-p) >> (VIEW_SHIFT + PROJECTION_SHIFT));
+}
+
+// Transform and project the needed vertices in first..end - 1
+static void transform_vertices(const FrameSetup* setup, int first, int end) {
+    // Rotated steps * Q32 step scaled back down to Q16.16
+    const int step_shift = STEP_SHIFT - VIEW_SHIFT;
+    const FixedTransform* f = &setup->transform;
+    const int16_t* vertices = setup->mesh->vertices;
+    int center_x = setup->center_x, center_y = setup->center_y;
+    bool depth = setup->vertex_depth;
+    int32_t depth_near = setup->depth_near, depth_scale = setup->depth_scale;
+    
+    for(int i = first; i < end; i++) {
+        if(!vertex_needed[i]) continue;
+        
+        int32_t vx = vertices[i * 3 + 0];
+        int32_t vy = vertices[i * 3 + 1];
+        int32_t vz = vertices[i * 3 + 2];
+        
+        // int16 * Q1.14 sums of a rotation row stay under 2^31
+        int32_t rx = (vx * f->rotation[0][0] + vy * f->rotation[1][0] + vz * f->rotation[2][0]) >> ROTATION_SHIFT;
+        int32_t ry = (vx * f->rotation[0][1] + vy * f->rotation[1][1] + vz * f->rotation[2][1]) >> ROTATION_SHIFT;
+        int32_t rz = (vx * f->rotation[0][2] + vy * f->rotation[1][2] + vz * f->rotation[2][2]) >> ROTATION_SHIFT;
+        
+        CachedVertex* cv = &vertex_cache[i];
+        cv->view.x = (int32_t)(((int64_t)rx * f->step) >> step_shift) + f->translation.x;
+        cv->view.y = (int32_t)(((int64_t)ry * f->step) >> step_shift) + f->translation.y;
+        cv->view.z = (int32_t)(((int64_t)rz * f->step) >> step_shift) + f->translation.z;
+        
+        // Vertices too close to the camera are never projected,
+        // triangles using them get skipped
+        cv->in_front = cv->view.z >= (1 << VIEW_SHIFT);
+        if(cv->in_front) {
+            // One divide per vertex, shared by x and y
+            int32_t inv_z = (PROJECTION_DISTANCE << (PROJECTION_SHIFT + VIEW_SHIFT - 8)) / (cv->view.z >> 8);
+            cv->x = clamp_screen_coord(project_fixed(cv->view.x, inv_z) + center_x);
+            cv->y = clamp_screen_coord(project_fixed(-cv->view.y, inv_z) + center_y);
+        }
+        if(depth) {
+            // Q8 view z times Q8 levels per unit
+            int32_t d = (((cv->view.z - depth_near) >> 8) * depth_scale) >> 16;
+            cv->depth = d < 0 ? 0 : d > DEPTH_FAR ? DEPTH_FAR : (uint8_t)d;
+        }
+    }
+}
+
+static const Vec3f* cluster_eye(const FrameSetup* setup) {
+    return &setup->transform.cluster_eye;
+}
+
+// Lambert term of a face, 0..256
+static int face_light(const FrameSetup* setup, int face) {
+    const FixedPlane* plane = &setup->planes[face];
+    // Q1.14 * Q1.14, at most 3 << 28 for unit vectors
+    int32_t d = plane->normal[0] * setup->light[0] + plane->normal[1] * setup->light[1] +
+                plane->normal[2] * setup->light[2];
+    return d <= 0 ? 0 : d >> (2 * NORMAL_SHIFT - 8);
+}
+
+#else
+// Transform and project the needed vertices in first..end - 1
+static void transform_vertices(FrameSetup* setup, int first, int end) {
+    Matrix4x4* model_matrix = &setup->transform;
+    const int16_t* vertices = setup->mesh->vertices;
+    int center_x = setup->center_x, center_y = setup->center_y;
+    bool depth = setup->vertex_depth;
+    float depth_near = setup->depth_near, depth_scale = setup->depth_scale;
+    
+    for(int i = first; i < end; i++) {
+        if(!vertex_needed[i]) continue;
+        
+        Vec3f v = {
+            vertices[i * 3 + 0],
+            vertices[i * 3 + 1],
+            vertices[i * 3 + 2]
+        };
+        
+        CachedVertex* cv = &vertex_cache[i];
+        transform_point(model_matrix, &v, &cv->view);
+        
+        // Vertices too close to the camera are never projected,
+        // triangles using them get skipped
+        cv->in_front = cv->view.z >= 1.0f;
+        if(cv->in_front) {
+            cv->x = clamp_screen_coord((int)((cv->view.x * PROJECTION_DISTANCE) / cv->view.z) + center_x);
+            cv->y = clamp_screen_coord((int)((-cv->view.y * PROJECTION_DISTANCE) / cv->view.z) + center_y);
+        }
+        if(depth) {
+            float d = (cv->view.z - depth_near) * depth_scale;
+            cv->depth = d < 0 ? 0 : d > DEPTH_FAR ? DEPTH_FAR : (uint8_t)d;
+        }
+    }
+}
+
+static const Vec3f* cluster_eye(const FrameSetup* setup) {
+    return &setup->eye;
+}
+
+// Model space backface test, the face is turned towards the eye when the
+// eye lies on the front side of its plane
+static bool face_faces_eye(const float* planes, int face, const Vec3f* eye) {
+    const float* plane = &planes[face * 4];
+    return plane[0] * eye->x + plane[1] * eye->y + plane[2] * eye->z > plane[3];
+}
+
+// Lambert term of a face, 0..256
+static int face_light(const FrameSetup* setup, int face) {
+    const float* plane = &setup->planes[face * 4];
+    float d = plane[0] * setup->light.x + plane[1] * setup->light.y + plane[2] * setup->light.z;
+    return d <= 0 ? 0 : (int)(d * 256);
+}
+#endif
+
+// Dark pixels out of 16 for a face, never all or none so lit faces keep
+// their shape against the background
+static int face_dither_level(const FrameSetup* setup, int face) {
+    int brightness = SHADE_AMBIENT + (((256 - SHADE_AMBIENT) * face_light(setup, face)) >> 8);
+    int level = DITHER_LEVELS - ((brightness * DITHER_LEVELS + 128) >> 8);
+    if(level < 1) return 1;
+    if(level > DITHER_LEVELS - 1) return DITHER_LEVELS - 1;
+    return level;
+}
+
+// Whole-cluster backface test from the cluster's bounding sphere and normal
+// cone. With v = center - eye at angle a to the cone axis and cone
+// half-angle h, every face is turned away when even the normal tilted
+// furthest towards the eye still sees the sphere from behind:
+// |v| * cos(a + h) >= radius, expanded so it needs no trig or square root.
+// Conservative, a skipped cluster never holds a front face.
+static bool cluster_faces_away(const TeapotMesh* mesh, int cluster, const Vec3f* eye) {
+    const float* bounds = &mesh->cluster_bounds[cluster * 9];
+    float vx = bounds[0] - eye->x;
+    float vy = bounds[1] - eye->y;
+    float vz = bounds[2] - eye->z;
+    float along = vx * bounds[4] + vy * bounds[5] + vz * bounds[6]; // |v| cos(a)
+    float margin = along * bounds[7] - bounds[3]; // |v| cos(a) cos(h) - radius
+    if(margin < 0) return false;
+    float across_sq = vx * vx + vy * vy + vz * vz - along * along; // (|v| sin(a))^2
+    return margin * margin >= across_sq * bounds[8] * bounds[8];
+}
+
+// Charge the time since start to a stage and return the new start
+static uint32_t profile_lap(RenderStats* stats, ProfileStage stage, uint32_t start) {
+    uint32_t now = profiler_ticks();
+    stats->stage_ticks[stage] += now - start;
+    return now;
+}
+
+// True when a view space sphere lies entirely behind the near plane or
+// outside one of the planes through the eye and the screen edges
+static bool sphere_outside_view(const Vec3f* c, float radius, int width, int height, int center_x, int center_y) {
+    if(c->z + radius < 1.0f) return true;
+    
+    // Edge plane normals scaled by PROJECTION_DISTANCE, inside is positive:
+    // left, right, top and bottom. Projection truncates towards zero, so
+    // the left and top planes sit one pixel out.
+    const float d = PROJECTION_DISTANCE;
+    const float planes[4][3] = {
+        {d, 0, center_x + 1},
+        {-d, 0, width - center_x},
+        {0, -d, center_y + 1},
+        {0, d, height - center_y},
+    };
+    for(int i = 0; i < 4; i++) {
+        const float* n = planes[i];
+        float distance = n[0] * c->x + n[1] * c->y + n[2] * c->z;
+        if(distance < -radius * sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2])) return true;
+    }
+    return false;
+}
+
+// Build the per-frame transform, returns false when the caches are missing
+static bool frame_setup(
+    FrameSetup* setup,
+    const RenderBuffer* rb,
+    const TeapotCamera* camera,
+    RenderMode mode,
+    uint8_t lod) {
+    if(!rb->buffer || !vertex_cache || !face_front || !face_visible || !vertex_needed || lod >= teapot_lod_count) return false;
+    setup->lod = lod;
+    setup->mesh = teapot_lods[lod];
+    setup->center_x = rb->width / 2;
+    setup->center_y = rb->height / 2;
+    
+    setup->depth = NULL;
+    if(mode == RenderModeHidden) {
+        if(!depth_buffer || (size_t)rb->width * rb->height > depth_buffer_size) return false;
+        setup->depth = depth_buffer;
+    }
+    if(mode == RenderModeSolid && !face_order) return false;
+    
+    // Whole-model rejection with the mesh's bounding sphere in view space
+    Matrix4x4 rot;
+    build_rotation_matrix(&rot, camera);
+    const float* bounds = setup->mesh->bounding_sphere;
+    Vec3f sphere = {bounds[0], bounds[1], bounds[2]};
+    Vec3f view;
+    transform_point(&rot, &sphere, &view);
+    view.x = view.x * camera->scale + camera->position.x;
+    view.y = view.y * camera->scale + camera->position.y;
+    view.z = view.z * camera->scale + camera->position.z;
+    float radius = bounds[3] * camera->scale;
+    setup->outside =
+        sphere_outside_view(&view, radius, rb->width, rb->height, setup->center_x, setup->center_y);
+    
+    // Depth 0 to DEPTH_FAR spans the bounding sphere
+    setup->vertex_depth = mode == RenderModeHidden || mode == RenderModeSolid;
+    float depth_near = view.z - radius;
+    float depth_scale = DEPTH_FAR / (2 * radius);
+    
+    // The light stays put relative to the viewer, turn it back into model
+    // space with the transposed rotation so face normals need no transform
+    Vec3f light = {0, 0, 0};
+    if(mode == RenderModeSolid) {
+        light.x = rot.m[0][0] * light_direction.x + rot.m[0][1] * light_direction.y + rot.m[0][2] * light_direction.z;
+        light.y = rot.m[1][0] * light_direction.x + rot.m[1][1] * light_direction.y + rot.m[1][2] * light_direction.z;
+        light.z = rot.m[2][0] * light_direction.x + rot.m[2][1] * light_direction.y + rot.m[2][2] * light_direction.z;
+    }
+#if TEAPOT_FIXED_POINT
+    if(!fixed_planes[lod]) return false;
+    build_fixed_transform(&setup->transform, setup->mesh, &rot, camera);
+    setup->planes = fixed_planes[lod];
+    setup->depth_near = float_to_fixed(depth_near, VIEW_SHIFT);
+    setup->depth_scale = float_to_fixed(depth_scale, 8);
+    setup->light[0] = (int16_t)float_to_fixed(light.x, NORMAL_SHIFT);
+    setup->light[1] = (int16_t)float_to_fixed(light.y, NORMAL_SHIFT);
+    setup->light[2] = (int16_t)float_to_fixed(light.z, NORMAL_SHIFT);
+#else
+    setup->depth_near = depth_near;
+    setup->depth_scale = depth_scale;
+    setup->light = light;
+    // Build the combined model transform once per frame
+    build_model_matrix(&setup->transform, &rot, camera);
+    model_space_eye(&setup->transform, camera->scale, &setup->eye);
+    fold_quantization(&setup->transform, setup->mesh);
+    setup->planes = setup->mesh->face_planes;
+#endif
+    return true;
+}
+
+// Cull back faces in model space before touching any vertex, whole clusters
+// first, and mark the vertices the remaining triangles use. Returns the
+// number of triangles covered.
+static int cull_cluster(const FrameSetup* setup, int c, RenderStats* stats) {
+    const TeapotMesh* mesh = setup->mesh;
+    const uint16_t* indices = mesh->indices;
+#if TEAPOT_FIXED_POINT
+    const FixedPlane* planes = setup->planes;
+    const FixedTransform* eye = &setup->transform;
+#else
+    const float* planes = setup->planes;
+    const Vec3f* eye = &setup->eye;
+#endif
+    int first = mesh->clusters[c * 2 + 0];
+    int last = first + mesh->clusters[c * 2 + 1];
+    
+    if(cluster_faces_away(mesh, c, cluster_eye(setup))) {
+        memset(&face_front[first], 0, sizeof(bool) * (last - first));
+        stats->clusters_skipped++;
+        stats->triangles_skipped += last - first;
+        return last - first;
+    }
+    bool* front = face_front;
+    bool* needed = vertex_needed;
+    for(int i = first; i < last; i++) {
+        front[i] = face_faces_eye(planes, i, eye);
+        if(front[i]) {
+            needed[indices[i * 3 + 0]] = true;
+            needed[indices[i * 3 + 1]] = true;
+            needed[indices[i * 3 + 2]] = true;
+        }
+    }
+    return last - first;
+}
+
+// Drop a front face that is too close to the camera or off screen
+static bool face_on_screen(int width, int height, const uint16_t* indices, int i) {
+    CachedVertex* cv1 = &vertex_cache[indices[i * 3 + 0]];
+    CachedVertex* cv2 = &vertex_cache[indices[i * 3 + 1]];
+    CachedVertex* cv3 = &vertex_cache[indices[i * 3 + 2]];
+    
+    // Skip triangles with vertices too close to camera
+    if(!cv1->in_front || !cv2->in_front || !cv3->in_front) {
+        return false;
+    }
+    
+    int x1 = cv1->x, y1 = cv1->y;
+    int x2 = cv2->x, y2 = cv2->y;
+    int x3 = cv3->x, y3 = cv3->y;
+    
+    // Check if any part of triangle is on screen
+    return !((x1 < 0 && x2 < 0 && x3 < 0) || 
+             (x1 >= width && x2 >= width && x3 >= width) ||
+             (y1 < 0 && y2 < 0 && y3 < 0) || 
+             (y1 >= height && y2 >= height && y3 >= height));
+}
+
+// x in Q16 where a triangle edge from (x0, y0) crosses half row y2, given the
+// Q16 step per half row
+static int32_t edge_x(int x0, int y0, int32_t step, int y2) {
+    return x0 * 65536 + step * (y2 - 2 * y0);
+}
+
+// Keep the nearer depth of a projected triangle in every pixel it touches.
+// Each row is filled over the triangle's extent within half a pixel above
+// and below the row center, which covers the pixels its edges are drawn on.
+// The depth is interpolated in screen space from the vertex depths and
+// clamped to their range where the row runs past the triangle.
+static void depth_fill_triangle(
+    uint8_t* depth,
+    int width,
+    int height,
+    const CachedVertex* a,
+    const CachedVertex* b,
+    const CachedVertex* c) {
+    // Sort the corners top to bottom
+    const CachedVertex* t;
+    if(b->y < a->y) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    if(c->y < a->y) {
+        t = a;
+        a = c;
+        c = t;
+    }
+    if(c->y < b->y) {
+        t = b;
+        b = c;
+        c = t;
+    }
+    int x0 = a->x, y0 = a->y, z0 = a->depth;
+    int x1 = b->x, y1 = b->y, z1 = b->depth;
+    int x2 = c->x, y2 = c->y, z2 = c->depth;
+    if(y2 < 0 || y0 >= height) return;
+    
+    // Edge-on triangles cover nothing, their edges are tested against the
+    // triangles around them
+    int area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+    if(area == 0) return;
+    
+    // Q8 depth plane, z = z0 + dzdx * (x - x0) + dzdy * (y - y0). The
+    // fixed-point scaling multiplies, shifting negative values left is undefined
+    int32_t dzdx = (int32_t)((int64_t)((z1 - z0) * (y2 - y0) - (z2 - z0) * (y1 - y0)) * (1 << DEPTH_SHIFT) / area);
+    int32_t dzdy = (int32_t)((int64_t)((z2 - z0) * (x1 - x0) - (z1 - z0) * (x2 - x0)) * (1 << DEPTH_SHIFT) / area);
+    int z_min = z0 < z1 ? z0 : z1;
+    int z_max = z0 > z1 ? z0 : z1;
+    if(z2 < z_min) z_min = z2;
+    if(z2 > z_max) z_max = z2;
+    z_min *= 1 << DEPTH_SHIFT;
+    z_max *= 1 << DEPTH_SHIFT;
+    
+    // Q16 x steps per half row, y2 > y0 as the triangle has an area
+    int32_t long_step = (int32_t)((int64_t)(x2 - x0) * 65536 / (2 * (y2 - y0)));
+    int32_t upper_step = y1 > y0 ? (int32_t)((int64_t)(x1 - x0) * 65536 / (2 * (y1 - y0))) : 0;
+    int32_t lower_step = y2 > y1 ? (int32_t)((int64_t)(x2 - x1) * 65536 / (2 * (y2 - y1))) : 0;
+    
+    int y_first = y0 > 0 ? y0 : 0;
+    int y_last = y2 < height - 1 ? y2 : height - 1;
+    for(int y = y_first; y <= y_last; y++) {
+        // Half rows above and below the center, inside the triangle
+        int top = 2 * y - 1 > 2 * y0 ? 2 * y - 1 : 2 * y0;
+        int bottom = 2 * y + 1 < 2 * y2 ? 2 * y + 1 : 2 * y2;
+        
+        // The extent is reached on one of these ends or at the middle vertex
+        int32_t left = edge_x(x0, y0, long_step, top);
+        int32_t right = left;
+        int32_t ends[3] = {
+            edge_x(x0, y0, long_step, bottom),
+            top <= 2 * y1 ? edge_x(x0, y0, upper_step, top) : edge_x(x1, y1, lower_step, top),
+            bottom <= 2 * y1 ? edge_x(x0, y0, upper_step, bottom) : edge_x(x1, y1, lower_step, bottom),
+        };
+        for(int i = 0; i < 3; i++) {
+            if(ends[i] < left) left = ends[i];
+            if(ends[i] > right) right = ends[i];
+        }
+        if(top <= 2 * y1 && 2 * y1 <= bottom) {
+            if(x1 * 65536 < left) left = x1 * 65536;
+            if(x1 * 65536 > right) right = x1 * 65536;
+        }
+        
+        int x_first = left >> 16;
+        int x_last = (right + 0xFFFF) >> 16;
+        if(x_first < 0) x_first = 0;
+        if(x_last > width - 1) x_last = width - 1;
+        if(x_first > x_last) continue;
+        
+        int64_t z_start = (int64_t)z0 * (1 << DEPTH_SHIFT) + (int64_t)dzdx * (x_first - x0) + (int64_t)dzdy * (y - y0);
+        if(z_start < -(1 << 24)) z_start = -(1 << 24);
+        if(z_start > (1 << 24)) z_start = 1 << 24;
+        int32_t z = (int32_t)z_start;
+        uint8_t* row = depth + y * width;
+        for(int x = x_first; x <= x_last; x++) {
+            int d = z < z_min ? z_min : z > z_max ? z_max : z;
+            d >>= DEPTH_SHIFT;
+            if(d < row[x]) row[x] = (uint8_t)d;
+            z += dzdx;
+        }
+    }
+}
+
+// Fill the pixel centers inside a projected triangle with a dither pattern,
+// one row span at a time. Centers exactly on a right or bottom edge are
+// left to the neighbouring triangle, so shared edges are filled once and
+// leave no gaps.
+static void fill_triangle(
+    RenderBuffer* rb,
+    const CachedVertex* a,
+    const CachedVertex* b,
+    const CachedVertex* c,
+    const uint8_t* pattern) {
+    // Sort the corners top to bottom
+    const CachedVertex* t;
+    if(b->y < a->y) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    if(c->y < a->y) {
+        t = a;
+        a = c;
+        c = t;
+    }
+    if(c->y < b->y) {
+        t = b;
+        b = c;
+        c = t;
+    }
+    int x0 = a->x, y0 = a->y;
+    int x1 = b->x, y1 = b->y;
+    int x2 = c->x, y2 = c->y;
+    if(y0 == y2 || y2 <= 0 || y0 >= rb->height) return;
+    
+    // Q16 x steps per row
+    int32_t long_step = (int32_t)((int64_t)(x2 - x0) * 65536 / (y2 - y0));
+    int32_t upper_step = y1 > y0 ? (int32_t)((int64_t)(x1 - x0) * 65536 / (y1 - y0)) : 0;
+    int32_t lower_step = y2 > y1 ? (int32_t)((int64_t)(x2 - x1) * 65536 / (y2 - y1)) : 0;
+    
+    int stride = rb->width / 8;
+    int x_max = rb->width - 1;
+    int y_first = y0 > 0 ? y0 : 0;
+    int y_end = y2 < rb->height ? y2 : rb->height;
+    for(int y = y_first; y < y_end; y++) {
+        int32_t xa = x0 * 65536 + long_step * (y - y0);
+        int32_t xb = y < y1 ? x0 * 65536 + upper_step * (y - y0) : x1 * 65536 + lower_step * (y - y1);
+        int32_t left = xa < xb ? xa : xb;
+        int32_t right = xa < xb ? xb : xa;
+        
+        // Centers from ceil(left) up to, not including, ceil(right)
+        int first = (left + 0xFFFF) >> 16;
+        int last = ((right + 0xFFFF) >> 16) - 1;
+        if(first < 0) first = 0;
+        if(last > x_max) last = x_max;
+        if(first > last) continue;
+        buffer_fill_span(rb->buffer + y * stride, first, last, pattern[y & 3]);
+    }
+}
+
+// Draw an edge once if either of its triangles is visible
+static void draw_edge(RenderBuffer* rb, const uint16_t* edges, const uint8_t* edge_flags, RenderMode mode, int i) {
+    const uint16_t* edge = &edges[i * 4];
+    bool visible1 = face_visible[edge[2]];
+    bool visible2 = edge[3] != TEAPOT_NO_FACE && face_visible[edge[3]];
+    if(!visible1 && !visible2) {
+        return;
+    }
+    
+    // Silhouette edges split a front and a back facing triangle (open
+    // borders count as back facing), crease edges bend sharply between
+    // front faces. Facing, not visibility, decides, as a front face dropped
+    // at the near plane or the screen edge is still in front of its
+    // neighbours.
+    if(mode == RenderModeSilhouette) {
+        bool front1 = face_front[edge[2]];
+        bool front2 = edge[3] != TEAPOT_NO_FACE && face_front[edge[3]];
+        if(front1 == front2 && !(edge_flags[i] & TEAPOT_EDGE_CREASE)) {
+            return;
+        }
+    }
+    
+    CachedVertex* cv1 = &vertex_cache[edge[0]];
+    CachedVertex* cv2 = &vertex_cache[edge[1]];
+    buffer_draw_line(rb, cv1->x, cv1->y, cv2->x, cv2->y);
+}
+
+// Draw an edge of a visible triangle where the depth buffer shows it
+static void draw_edge_depth(RenderBuffer* rb, const uint8_t* depth, const uint16_t* edges, int i) {
+    const uint16_t* edge = &edges[i * 4];
+    if(!face_visible[edge[2]] && !(edge[3] != TEAPOT_NO_FACE && face_visible[edge[3]])) {
+        return;
+    }
+    
+    CachedVertex* cv1 = &vertex_cache[edge[0]];
+    CachedVertex* cv2 = &vertex_cache[edge[1]];
+    buffer_draw_line_depth(rb, depth, cv1->x, cv1->y, cv1->depth, cv2->x, cv2->y, cv2->depth);
+}
+
+// Painter's sort key of a face, the mean depth of its corners
+static int face_sort_key(const uint16_t* indices, int i) {
+    int sum = vertex_cache[indices[i * 3 + 0]].depth + vertex_cache[indices[i * 3 + 1]].depth +
+              vertex_cache[indices[i * 3 + 2]].depth;
+    return (sum * 85) >> 8; // sum / 3, at most 253
+}
+
+// Clear the buffer and set up the frame, returns false when nothing can be
+// drawn
+static bool render_job_begin(
+    RenderJob* job,
+    RenderBuffer* rb,
+    const TeapotCamera* camera,
+    RenderMode mode,
+    uint8_t lod) {
+    uint32_t start = profiler_ticks();
+    
+    // Reset polygon count and stage times
+    memset(&job->stats, 0, sizeof(RenderStats));
+    job->rb = rb;
+    job->mode = mode;
+    job->phase = RenderPhaseDone;
+    job->next = 0;
+    job->sorted = 0;
+    
+    // Clear buffer before new render
+    render_buffer_clear(rb);
+    start = profile_lap(&job->stats, ProfileStageClear, start);
+    
+    if(!frame_setup(&job->setup, rb, camera, mode, lod)) return false;
+    if(job->setup.outside) {
+        // The cleared buffer is the whole frame
+        profile_lap(&job->stats, ProfileStageSetup, start);
+        return true;
+    }
+    memset(vertex_needed, 0, sizeof(bool) * job->setup.mesh->vertex_count);
+    if(job->setup.depth) {
+        memset(job->setup.depth, DEPTH_FAR, (size_t)rb->width * rb->height);
+    }
+    job->phase = RenderPhaseCull;
+    profile_lap(&job->stats, ProfileStageSetup, start);
+    return true;
+}
+
+// Run the frame's passes until about budget clusters' triangles, vertices,
+// triangles or edges were processed, returns true when the frame is done.
+// Loops work on locals, as every byte written to the buffer or the flag
+// arrays could otherwise alias the job and force reloads.
+static bool render_job_step(RenderJob* job, int budget) {
+    FrameSetup* setup = &job->setup;
+    const TeapotMesh* mesh = setup->mesh;
+    RenderBuffer* rb = job->rb;
+    uint32_t start = profiler_ticks();
+    
+    while(job->phase != RenderPhaseDone && budget > 0) {
+        switch(job->phase) {
+        case RenderPhaseCull:
+            while(job->next < mesh->cluster_count && budget > 0) {
+                budget -= cull_cluster(setup, job->next++, &job->stats);
+            }
+            start = profile_lap(&job->stats, ProfileStageCull, start);
+            if(job->next < mesh->cluster_count) break;
+            job->phase = RenderPhaseTransform;
+            job->next = 0;
+            break;
+        case RenderPhaseTransform: {
+            int end = budget < mesh->vertex_count - job->next ? job->next + budget : mesh->vertex_count;
+            transform_vertices(setup, job->next, end);
+            budget -= end - job->next;
+            job->next = end;
+            start = profile_lap(&job->stats, ProfileStageTransform, start);
+            if(job->next < mesh->vertex_count) break;
+            job->phase = RenderPhaseScreen;
+            job->next = 0;
+            break;
+        }
+        case RenderPhaseScreen: {
+            int end = budget < mesh->triangle_count - job->next ? job->next + budget : mesh->triangle_count;
+            const uint16_t* indices = mesh->indices;
+            int width = rb->width, height = rb->height;
+            uint32_t polygons = 0;
+            const bool* front = face_front;
+            bool* visible = face_visible;
+            for(int i = job->next; i < end; i++) {
+                visible[i] = front[i] && face_on_screen(width, height, indices, i);
+                polygons += visible[i];
+            }
+            job->stats.polygons_drawn += polygons;
+            budget -= end - job->next;
+            job->next = end;
+            start = profile_lap(&job->stats, ProfileStageCull, start);
+            if(job->next < mesh->triangle_count) break;
+            if(job->mode == RenderModeSolid) {
+                job->phase = RenderPhaseSort;
+            } else {
+                job->phase = setup->depth ? RenderPhaseDepth : RenderPhaseEdges;
+            }
+            job->next = 0;
+            break;
+        }
+        case RenderPhaseDepth: {
+            int end = budget < mesh->triangle_count - job->next ? job->next + budget : mesh->triangle_count;
+            const uint16_t* indices = mesh->indices;
+            uint8_t* depth = setup->depth;
+            int width = rb->width, height = rb->height;
+            for(int i = job->next; i < end; i++) {
+                if(!face_visible[i]) continue;
+                depth_fill_triangle(
+                    depth,
+                    width,
+                    height,
+                    &vertex_cache[indices[i * 3 + 0]],
+                    &vertex_cache[indices[i * 3 + 1]],
+                    &vertex_cache[indices[i * 3 + 2]]);
+            }
+            budget -= end - job->next;
+            job->next = end;
+            start = profile_lap(&job->stats, ProfileStageRaster, start);
+            if(job->next < mesh->triangle_count) break;
+            job->phase = RenderPhaseEdges;
+            job->next = 0;
+            break;
+        }
+        case RenderPhaseEdges: {
+            int end = budget < mesh->edge_count - job->next ? job->next + budget : mesh->edge_count;
+            const uint16_t* edges = mesh->edges;
+            const uint8_t* edge_flags = mesh->edge_flags;
+            RenderMode mode = job->mode;
+            const uint8_t* depth = setup->depth;
+            if(depth) {
+                for(int i = job->next; i < end; i++) {
+                    draw_edge_depth(rb, depth, edges, i);
+                }
+            } else {
+                for(int i = job->next; i < end; i++) {
+                    draw_edge(rb, edges, edge_flags, mode, i);
+                }
+            }
+            budget -= end - job->next;
+            job->next = end;
+            start = profile_lap(&job->stats, ProfileStageRaster, start);
+            if(job->next < mesh->edge_count) break;
+            job->phase = RenderPhaseDone;
+            break;
+        }
+        case RenderPhaseSort: {
+            // Counting sort on the mean vertex depth, farthest bucket first.
+            // Linear in the triangles and cheap, so it is never sliced.
+            const uint16_t* indices = mesh->indices;
+            uint16_t* order = face_order;
+            memset(sort_counts, 0, sizeof(sort_counts));
+            for(int i = 0; i < mesh->triangle_count; i++) {
+                if(!face_visible[i]) continue;
+                sort_counts[face_sort_key(indices, i)]++;
+            }
+            int sorted = 0;
+            for(int key = SORT_BUCKETS - 1; key >= 0; key--) {
+                int count = sort_counts[key];
+                sort_counts[key] = sorted;
+                sorted += count;
+            }
+            for(int i = 0; i < mesh->triangle_count; i++) {
+                if(!face_visible[i]) continue;
+                order[sort_counts[face_sort_key(indices, i)]++] = i;
+            }
+            job->sorted = sorted;
+            budget -= mesh->triangle_count;
+            start = profile_lap(&job->stats, ProfileStageCull, start);
+            job->phase = RenderPhaseFill;
+            job->next = 0;
+            break;
+        }
+        case RenderPhaseFill: {
+            int end = budget < job->sorted - job->next ? job->next + budget : job->sorted;
+            const uint16_t* indices = mesh->indices;
+            const uint16_t* order = face_order;
+            for(int i = job->next; i < end; i++) {
+                int face = order[i];
+                fill_triangle(
+                    rb,
+                    &vertex_cache[indices[face * 3 + 0]],
+                    &vertex_cache[indices[face * 3 + 1]],
+                    &vertex_cache[indices[face * 3 + 2]],
+                    dither_patterns[face_dither_level(setup, face)]);
+            }
+            budget -= end - job->next;
+            job->next = end;
+            start = profile_lap(&job->stats, ProfileStageRaster, start);
+            if(job->next < job->sorted) break;
+            job->phase = RenderPhaseDone;
+            break;
+        }
+        case RenderPhaseDone:
+            break;
+        }
+    }
+    return job->phase == RenderPhaseDone;
+}
+
+void render_complete_model(
+    RenderBuffer* rb,
+    const TeapotCamera* camera,
+    RenderMode mode,
+    uint8_t lod,
+    RenderStats* stats) {
+    RenderJob job;
+    if(render_job_begin(&job, rb, camera, mode, lod)) {
+        render_job_step(&job, INT_MAX);
+    }
+    *stats = job.stats;
+}
+
+void render_model_begin(RenderBuffer* rb, const TeapotCamera* camera, RenderMode mode, uint8_t lod) {
+    render_job_begin(&sliced_job, rb, camera, mode, lod);
+}
+
+bool render_model_step(uint16_t budget, RenderStats* stats) {
+    if(!render_job_step(&sliced_job, budget)) return false;
+    *stats = sliced_job.stats;
+    return true;
+}
+
+#ifdef TEAPOT_HOST
+bool render_transform_all(const RenderBuffer* rb, const TeapotCamera* camera, uint8_t lod) {
+    FrameSetup setup;
+    if(!frame_setup(&setup, rb, camera, RenderModeWireframe, lod)) return false;
+    int count = setup.mesh->vertex_count;
+    memset(vertex_needed, true, sizeof(bool) * count);
+    transform_vertices(&setup, 0, count);
+    return true;
+}
+
+bool render_transformed_vertex(int vertex, Vec3f* view, int16_t* x, int16_t* y) {
+    const CachedVertex* cv = &vertex_cache[vertex];
+#if TEAPOT_FIXED_POINT
+    view->x = cv->view.x / (float)(1 << VIEW_SHIFT);
+    view->y = cv->view.y / (float)(1 << VIEW_SHIFT);
+    view->z = cv->view.z / (float)(1 << VIEW_SHIFT);
+#else
+    *view = cv->view;
+#endif
+    *x = cv->x;
+    *y = cv->y;
+    return cv->in_front;
+}
+#endif
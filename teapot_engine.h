@@ -0,0 +1,140 @@
+#ifndef TEAPOT_ENGINE_H
+#define TEAPOT_ENGINE_H
+
+/*
+ * Portable Smol Teapot renderer core: math, culling and rasterization into a
+ * packed 1-bit buffer. It has no furi or GUI dependencies, so the same code
+ * runs in the Flipper app and in the host build (host/teapot_host.c).
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "teapot_profiler.h"
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define PROJECTION_DISTANCE 190
+
+typedef struct {
+    float x, y, z;
+} Vec3f;
+
+typedef struct {
+    float m[4][4];
+} Matrix4x4;
+
+// 1-bit render target, rows of width / 8 bytes with pixels packed LSB
+// first, as canvas_draw_xbm expects. Width must be a multiple of 8.
+typedef struct {
+    uint8_t* buffer;
+    uint16_t width;
+    uint16_t height;
+} RenderBuffer;
+
+#define TRIPLE_BUFFER_FRESH 0x04 // Set on the spare index when it is newer than front
+
+// Three render buffers shared by one writer (renderer) and one reader (GUI
+// draw callback) without locks. The writer draws into back and publishes it
+// by exchanging it with the spare, the reader swaps the spare into front
+// when a newer frame was published. Neither side ever waits for the other,
+// and the reader always shows the newest complete frame.
+typedef struct {
+    RenderBuffer buffers[3];
+    uint8_t back; // Writer only
+    uint8_t front; // Reader only
+    atomic_uint_fast8_t spare; // Buffer index, plus TRIPLE_BUFFER_FRESH
+} TripleBuffer;
+
+// Where the model is and how it is turned
+typedef struct {
+    Vec3f rotation; // Radians around X, Y and Z
+    Vec3f position; // View space position of the model center
+    float scale;
+} TeapotCamera;
+
+// What render_complete_model() draws
+typedef enum {
+    RenderModeWireframe, // Every edge of the visible triangles
+    RenderModeSilhouette, // Only outline and crease edges
+    RenderModeHidden, // Every edge, minus the pixels other triangles cover
+    RenderModeSolid, // Filled faces, flat shaded and dithered
+    RenderModeCount
+} RenderMode;
+
+extern const char* render_mode_names[RenderModeCount];
+
+// Per-frame render statistics
+typedef struct {
+    uint32_t polygons_drawn;
+    uint32_t clusters_skipped; // Triangle clusters rejected by one back-facing test
+    uint32_t triangles_skipped; // Triangles in those clusters, face tests saved
+    uint32_t stage_ticks[ProfileStageCount]; // profiler_ticks() per stage, blit stays 0
+} RenderStats;
+
+// Everything that determines a rendered frame, to skip renders of a frame
+// that is already in the buffer
+typedef struct {
+    TeapotCamera camera;
+    RenderMode mode;
+    uint8_t lod;
+    bool valid; // False when the buffer holds something else
+} RenderKey;
+
+bool render_key_changed(const RenderKey* key, const TeapotCamera* camera, RenderMode mode, uint8_t lod);
+void render_key_set(RenderKey* key, const TeapotCamera* camera, RenderMode mode, uint8_t lod);
+void render_key_invalidate(RenderKey* key);
+
+// Allocate a cleared buffer, returns false when out of memory
+bool render_buffer_init(RenderBuffer* rb, uint16_t width, uint16_t height);
+void render_buffer_clear(RenderBuffer* rb);
+void render_buffer_free(RenderBuffer* rb);
+
+// Allocate three cleared buffers, returns false when out of memory
+bool triple_buffer_init(TripleBuffer* tb, uint16_t width, uint16_t height);
+void triple_buffer_free(TripleBuffer* tb);
+// Writer: the buffer to draw the next frame into
+RenderBuffer* triple_buffer_back(TripleBuffer* tb);
+// Writer: hand the finished back buffer to the reader
+void triple_buffer_publish(TripleBuffer* tb);
+// Reader: the newest published frame
+RenderBuffer* triple_buffer_front(TripleBuffer* tb);
+
+// Draw a line, clipped to the buffer
+void buffer_draw_line(RenderBuffer* rb, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+// Allocate the per-frame vertex and face caches for the largest level of
+// detail in teapot_lods, and the depth buffer for frames of up to width x
+// height pixels (one byte each) that RenderModeHidden needs
+bool teapot_engine_init(uint16_t width, uint16_t height);
+void teapot_engine_free(void);
+
+// Clear the buffer and draw level lod of teapot_lods
+void render_complete_model(
+    RenderBuffer* rb,
+    const TeapotCamera* camera,
+    RenderMode mode,
+    uint8_t lod,
+    RenderStats* stats);
+
+// The same frame drawn in slices, so a caller can stop between them. Begin
+// clears the buffer, each step processes about budget triangles, vertices
+// or edges and returns true with the frame's stats once it is complete.
+// Only one frame can be in progress, render_complete_model() in between
+// discards it.
+void render_model_begin(RenderBuffer* rb, const TeapotCamera* camera, RenderMode mode, uint8_t lod);
+bool render_model_step(uint16_t budget, RenderStats* stats);
+
+#ifdef TEAPOT_HOST
+// Host benchmarks only: set up a frame of level lod for rb and run the
+// transform stage over every vertex, where a frame only runs it for the
+// vertices of front faces. Returns false when the caches are missing.
+bool render_transform_all(const RenderBuffer* rb, const TeapotCamera* camera, uint8_t lod);
+
+// View space and screen position of a vertex after render_transform_all(),
+// returns false when it was too close to the camera to be projected
+bool render_transformed_vertex(int vertex, Vec3f* view, int16_t* x, int16_t* y);
+#endif
+
+#endif // TEAPOT_ENGINE_H
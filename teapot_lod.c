@@ -0,0 +1,72 @@
+#include "teapot_lod.h"
+
+#include "teapot_profiler.h"
+
+/* generated level chains, each with its own symbol prefix */
+#if TEAPOT_LOD_FULL
+#include "teapot.h"
+_Static_assert(TEAPOT_LOD_COUNT == TEAPOT_LEVEL_COUNT, "TEAPOT_LOD_COUNT must match teapot.h");
+#else
+#include "teapot_decimated.h"
+_Static_assert(TEAPOT_LOD_COUNT == TEAPOT_DECIMATED_LEVEL_COUNT, "TEAPOT_LOD_COUNT must match teapot_decimated.h");
+#endif
+
+// Frames in a row over budget before stepping coarser
+#define LOD_COARSEN_FRAMES 2
+// Frames in a row with headroom before stepping finer
+#define LOD_REFINE_FRAMES 15
+// A finer level must be predicted to fit this share of the budget, the gap
+// to 100% is the hysteresis band where the level stays put
+#define LOD_REFINE_PERCENT 75
+
+_Static_assert(TEAPOT_LOD_COUNT <= TEAPOT_LOD_MAX, "TEAPOT_LOD_MAX must hold the compiled-in levels");
+
+#if TEAPOT_LOD_FULL
+const TeapotMesh* const* teapot_lods = teapot_levels;
+#else
+const TeapotMesh* const* teapot_lods = teapot_decimated_levels;
+#endif
+uint8_t teapot_lod_count = TEAPOT_LOD_COUNT;
+
+bool teapot_lods_use(const TeapotMesh* const* levels, uint8_t count) {
+    if(count == 0 || count > TEAPOT_LOD_MAX) return false;
+    teapot_lods = levels;
+    teapot_lod_count = count;
+    return true;
+}
+
+void lod_governor_init(LodGovernor* governor, uint32_t target_fps) {
+    governor->lod = teapot_lod_count - 1;
+    governor->budget_ticks = 1000000 / target_fps * profiler_ticks_per_us();
+    governor->slow_frames = 0;
+    governor->fast_frames = 0;
+}
+
+uint8_t lod_governor_update(LodGovernor* governor, uint32_t frame_ticks) {
+    if(frame_ticks > governor->budget_ticks) {
+        governor->fast_frames = 0;
+        if(++governor->slow_frames >= LOD_COARSEN_FRAMES && governor->lod + 1 < teapot_lod_count) {
+            governor->lod++;
+            governor->slow_frames = 0;
+        }
+        return governor->lod;
+    }
+    governor->slow_frames = 0;
+
+    if(governor->lod == 0) return governor->lod;
+
+    // Render time grows with the triangle count, estimate the finer level's
+    // time from this frame
+    const TeapotMesh* mesh = teapot_lods[governor->lod];
+    const TeapotMesh* finer = teapot_lods[governor->lod - 1];
+    uint64_t predicted = (uint64_t)frame_ticks * finer->triangle_count / mesh->triangle_count;
+    if(predicted * 100 < (uint64_t)governor->budget_ticks * LOD_REFINE_PERCENT) {
+        if(++governor->fast_frames >= LOD_REFINE_FRAMES) {
+            governor->lod--;
+            governor->fast_frames = 0;
+        }
+    } else {
+        governor->fast_frames = 0;
+    }
+    return governor->lod;
+}
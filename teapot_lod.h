@@ -0,0 +1,56 @@
+#ifndef TEAPOT_LOD_H
+#define TEAPOT_LOD_H
+
+/*
+ * Level-of-detail registry and frame-time governor. The levels are the chain
+ * of one generated header, or of a mesh asset loaded at run time
+ * (teapot_asset.h), level 0 being the finest. The governor watches
+ * the render time of each frame and steps to a coarser level when frames run
+ * over the budget of the target frame rate, and back to a finer one only
+ * after a run of frames with enough headroom, so it does not flicker between
+ * levels.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "teapot_mesh.h"
+
+// Set to 1 to build with teapot.h (3472, 1199, 346 and 120 triangles, about
+// 220 KB) instead of teapot_decimated.h (346 and 120 triangles, about 25 KB).
+// The app gets finer levels from an SD card asset without the flash.
+#ifndef TEAPOT_LOD_FULL
+#define TEAPOT_LOD_FULL 0
+#endif
+
+// Levels in the chosen header, checked against it in teapot_lod.c
+#define TEAPOT_LOD_COUNT (TEAPOT_LOD_FULL ? 4 : 2)
+// Most levels teapot_lods_use() takes
+#define TEAPOT_LOD_MAX 8
+
+// Finest first, teapot_lod_count of them, the compiled-in levels unless
+// teapot_lods_use() replaced them
+extern const TeapotMesh* const* teapot_lods;
+extern uint8_t teapot_lod_count;
+
+// Render count other levels, finest first, such as a loaded asset's. Call
+// before teapot_engine_init() and lod_governor_init(), the levels must stay
+// valid until teapot_engine_free(). Returns false when count is 0 or above
+// TEAPOT_LOD_MAX.
+bool teapot_lods_use(const TeapotMesh* const* levels, uint8_t count);
+
+typedef struct {
+    uint8_t lod; // Level for the next frame
+    uint32_t budget_ticks; // profiler_ticks() per frame at the target rate
+    uint8_t slow_frames; // Consecutive frames over budget
+    uint8_t fast_frames; // Consecutive frames with room for a finer level
+} LodGovernor;
+
+// Start at the coarsest level, which is known to be cheap
+void lod_governor_init(LodGovernor* governor, uint32_t target_fps);
+
+// Feed the render time of a frame drawn at governor->lod, returns the level
+// for the next frame
+uint8_t lod_governor_update(LodGovernor* governor, uint32_t frame_ticks);
+
+#endif // TEAPOT_LOD_H
@@ -0,0 +1,37 @@
+#ifndef TEAPOT_MESH_H
+#define TEAPOT_MESH_H
+
+/*
+ * Layout of the meshes generated by obj_to_teapot_header.c. Each generated
+ * header defines its arrays with a name prefix and one TeapotMesh pointing at
+ * them, so any number of meshes can be compiled in side by side. Every mesh
+ * is centered on its bounding box, the origin is the rotation pivot. Vertex
+ * positions are int16, the model position of a vertex v is v * vertex_scale.
+ */
+
+#include <stdint.h>
+
+#define TEAPOT_NO_FACE 0xFFFF // Second face of an edge on an open border
+#define TEAPOT_EDGE_CREASE 0x01 // Edge flag, the adjacent faces bend sharply
+
+typedef struct {
+    const char* name;
+    uint16_t vertex_count;
+    uint16_t triangle_count;
+    uint16_t edge_count;
+    uint16_t cluster_count;
+    const int16_t* vertices; // 3 per vertex (x, y, z), quantized
+    float vertex_scale; // Model units per quantization step, the same on every axis
+    float bounds_min[3]; // Axis-aligned bounding box
+    float bounds_max[3];
+    float centroid[3]; // Area-weighted centroid of the surface
+    float bounding_sphere[4]; // Center x, y, z and radius
+    const uint16_t* indices; // 3 vertex indices per triangle
+    const float* face_planes; // 4 per triangle (unit normal, offset)
+    const uint16_t* clusters; // 2 per cluster (first triangle, triangle count)
+    const float* cluster_bounds; // 9 per cluster (sphere center, radius, cone axis, cos, sin)
+    const uint16_t* edges; // 4 per edge (vertex 1, vertex 2, face 1, face 2)
+    const uint8_t* edge_flags; // 1 per edge, TEAPOT_EDGE_CREASE
+} TeapotMesh;
+
+#endif // TEAPOT_MESH_H
@@ -0,0 +1,58 @@
+#include "teapot_profiler.h"
+
+#include <string.h>
+
+#ifdef TEAPOT_HOST
+#include <time.h>
+#else
+#include <furi_hal_cortex.h>
+#endif
+
+const char* profile_stage_names[ProfileStageCount] = {
+    "clear",
+    "setup",
+    "xform",
+    "cull",
+    "raster",
+    "blit",
+};
+
+#ifdef TEAPOT_HOST
+uint32_t profiler_ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+uint32_t profiler_ticks_per_us(void) {
+    return 1000;
+}
+#else
+// The timer start value is a DWT->CYCCNT sample
+uint32_t profiler_ticks(void) {
+    return furi_hal_cortex_timer_get(0).start;
+}
+
+uint32_t profiler_ticks_per_us(void) {
+    return furi_hal_cortex_instructions_per_microsecond();
+}
+#endif
+
+void frame_profile_reset(FrameProfile* profile) {
+    memset(profile, 0, sizeof(FrameProfile));
+}
+
+void profile_stats_add(ProfileStageStats* stats, uint32_t ticks) {
+    if(!stats->samples || ticks < stats->min) stats->min = ticks;
+    if(ticks > stats->max) stats->max = ticks;
+    stats->total += ticks;
+    stats->samples++;
+}
+
+void frame_profile_add(FrameProfile* profile, ProfileStage stage, uint32_t ticks) {
+    profile_stats_add(&profile->stages[stage], ticks);
+}
+
+uint32_t frame_profile_avg(const ProfileStageStats* stats) {
+    return stats->samples ? (uint32_t)(stats->total / stats->samples) : 0;
+}
@@ -0,0 +1,50 @@
+#ifndef TEAPOT_PROFILER_H
+#define TEAPOT_PROFILER_H
+
+/*
+ * Per-stage frame profiler. Stage times are raw ticks of a free-running
+ * 32-bit counter: the DWT cycle counter on the Flipper and CLOCK_MONOTONIC
+ * nanoseconds in the host build (-DTEAPOT_HOST). Intervals are taken with
+ * unsigned subtraction, so counter wrap-around is harmless.
+ */
+
+#include <stdint.h>
+
+// Render pipeline stages, in frame order
+typedef enum {
+    ProfileStageClear, // Render buffer clear
+    ProfileStageSetup, // Model matrix setup
+    ProfileStageTransform, // Vertex transform and projection
+    ProfileStageCull, // Backface and screen culling
+    ProfileStageRaster, // Line rasterization
+    ProfileStageBlit, // Render buffer to canvas, only measured by the app
+    ProfileStageCount
+} ProfileStage;
+
+extern const char* profile_stage_names[ProfileStageCount];
+
+// Running min/avg/max of one stage
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t samples;
+} ProfileStageStats;
+
+typedef struct {
+    ProfileStageStats stages[ProfileStageCount];
+    ProfileStageStats input_latency; // Input callback to frame drawn, app only
+} FrameProfile;
+
+uint32_t profiler_ticks(void);
+uint32_t profiler_ticks_per_us(void);
+
+void profile_stats_add(ProfileStageStats* stats, uint32_t ticks);
+
+void frame_profile_reset(FrameProfile* profile);
+void frame_profile_add(FrameProfile* profile, ProfileStage stage, uint32_t ticks);
+
+// Average ticks of a stage, 0 when it has no samples
+uint32_t frame_profile_avg(const ProfileStageStats* stats);
+
+#endif // TEAPOT_PROFILER_H
@@ -0,0 +1,145 @@
+#include "teapot_renderer.h"
+
+#include <stdlib.h>
+
+#define RENDERER_FLAG_REQUEST (1 << 0)
+#define RENDERER_FLAG_EXIT (1 << 1)
+
+// Progressive refinement, override with cdefines in application.fam
+#ifndef RENDER_REFINE_DELAY_MS
+#define RENDER_REFINE_DELAY_MS 250 // Still time before a coarse frame is redrawn at level 0
+#endif
+#ifndef RENDER_REFINE_SLICE
+#define RENDER_REFINE_SLICE 128 // Triangles, vertices or edges between checks for new input
+#endif
+
+#define MAILBOX_FRESH 0x04 // Set on the spare index when it holds a new request
+
+// Latest-value mailbox with the same index exchange as TripleBuffer: the
+// poster fills its own slot and swaps it with the spare, the render thread
+// swaps the spare out when it is fresh
+typedef struct {
+    RenderRequest slots[3];
+    uint8_t post; // Poster only
+    uint8_t take; // Render thread only
+    atomic_uint_fast8_t spare; // Slot index, plus MAILBOX_FRESH
+} RenderMailbox;
+
+struct TeapotRenderer {
+    FuriThread* thread;
+    TripleBuffer* frames;
+    RenderMailbox mailbox;
+    TeapotFrameCallback callback;
+    void* context;
+};
+
+static void render_mailbox_init(RenderMailbox* mailbox) {
+    mailbox->post = 0;
+    mailbox->take = 1;
+    atomic_init(&mailbox->spare, 2);
+}
+
+static void render_mailbox_post(RenderMailbox* mailbox, const RenderRequest* request) {
+    mailbox->slots[mailbox->post] = *request;
+    uint_fast8_t old = atomic_exchange_explicit(
+        &mailbox->spare, mailbox->post | MAILBOX_FRESH, memory_order_acq_rel);
+    mailbox->post = old & ~MAILBOX_FRESH;
+}
+
+// Returns false when nothing was posted since the last take
+static bool render_mailbox_take(RenderMailbox* mailbox, RenderRequest* request) {
+    if(!(atomic_load_explicit(&mailbox->spare, memory_order_relaxed) & MAILBOX_FRESH)) {
+        return false;
+    }
+    uint_fast8_t old = atomic_exchange_explicit(&mailbox->spare, mailbox->take, memory_order_acq_rel);
+    mailbox->take = old & ~MAILBOX_FRESH;
+    *request = mailbox->slots[mailbox->take];
+    return true;
+}
+
+// Redraw the shown view at the finest level a slice at a time, into the back
+// buffer, and publish it once complete. A new request or exit abandons the
+// frame between slices, leaving its flag set for the main loop, and returns
+// false.
+static bool teapot_renderer_refine(TeapotRenderer* renderer, RenderRequest* request, RenderKey* key) {
+    RenderStats stats;
+    render_model_begin(triple_buffer_back(renderer->frames), &request->camera, request->mode, 0);
+    while(!render_model_step(RENDER_REFINE_SLICE, &stats)) {
+        if(furi_thread_flags_get() & (RENDERER_FLAG_REQUEST | RENDERER_FLAG_EXIT)) return false;
+    }
+    triple_buffer_publish(renderer->frames);
+    
+    request->lod = 0;
+    request->from_input = false;
+    render_key_set(key, &request->camera, request->mode, request->lod);
+    renderer->callback(request, &stats, renderer->context);
+    return true;
+}
+
+static int32_t teapot_renderer_thread(void* context) {
+    TeapotRenderer* renderer = context;
+    RenderKey key = {0}; // What the newest published frame shows
+    RenderRequest shown; // The request behind that frame
+    bool coarse = false; // Shown frame is below level 0 and not yet refined
+    
+    while(true) {
+        uint32_t flags = furi_thread_flags_wait(
+            RENDERER_FLAG_REQUEST | RENDERER_FLAG_EXIT,
+            FuriFlagWaitAny,
+            coarse ? furi_ms_to_ticks(RENDER_REFINE_DELAY_MS) : FuriWaitForever);
+        if(flags == (uint32_t)FuriFlagErrorTimeout) {
+            // The view held still long enough, a cancelled refinement is
+            // retried if the request turns out to show the same view
+            coarse = !teapot_renderer_refine(renderer, &shown, &key);
+            continue;
+        }
+        if(flags & FuriFlagError) continue;
+        if(flags & RENDERER_FLAG_EXIT) break;
+        
+        RenderRequest request;
+        if(!render_mailbox_take(&renderer->mailbox, &request)) continue;
+        if(!render_key_changed(&key, &request.camera, request.mode, request.lod)) continue;
+        
+        RenderStats stats;
+        render_complete_model(
+            triple_buffer_back(renderer->frames), &request.camera, request.mode, request.lod, &stats);
+        triple_buffer_publish(renderer->frames);
+        render_key_set(&key, &request.camera, request.mode, request.lod);
+        shown = request;
+        coarse = request.lod != 0;
+        
+        renderer->callback(&request, &stats, renderer->context);
+    }
+    
+    return 0;
+}
+
+TeapotRenderer* teapot_renderer_alloc(
+    TripleBuffer* frames,
+    uint32_t stack_size,
+    FuriThreadPriority priority,
+    TeapotFrameCallback callback,
+    void* context) {
+    TeapotRenderer* renderer = malloc(sizeof(TeapotRenderer));
+    renderer->frames = frames;
+    renderer->callback = callback;
+    renderer->context = context;
+    render_mailbox_init(&renderer->mailbox);
+    
+    renderer->thread = furi_thread_alloc_ex("TeapotRender", stack_size, teapot_renderer_thread, renderer);
+    furi_thread_set_priority(renderer->thread, priority);
+    furi_thread_start(renderer->thread);
+    return renderer;
+}
+
+void teapot_renderer_free(TeapotRenderer* renderer) {
+    furi_thread_flags_set(furi_thread_get_id(renderer->thread), RENDERER_FLAG_EXIT);
+    furi_thread_join(renderer->thread);
+    furi_thread_free(renderer->thread);
+    free(renderer);
+}
+
+void teapot_renderer_post(TeapotRenderer* renderer, const RenderRequest* request) {
+    render_mailbox_post(&renderer->mailbox, request);
+    furi_thread_flags_set(furi_thread_get_id(renderer->thread), RENDERER_FLAG_REQUEST);
+}
@@ -0,0 +1,47 @@
+#ifndef TEAPOT_RENDERER_H
+#define TEAPOT_RENDERER_H
+
+/*
+ * Render thread. Input and animation post the latest camera to a lock-free
+ * mailbox, the thread renders it into a TripleBuffer and reports each new
+ * frame through a callback, so a slow render never holds up the poster.
+ * When a frame below level 0 stays on screen for RENDER_REFINE_DELAY_MS the
+ * thread redraws it at level 0 in slices, dropping the work as soon as a new
+ * request arrives, and reports it as one more frame with lod 0.
+ */
+
+#include <furi.h>
+
+#include "teapot_engine.h"
+
+// One render job, only the newest posted request is rendered
+typedef struct {
+    TeapotCamera camera;
+    RenderMode mode;
+    uint8_t lod; // Level of detail in teapot_lods
+    bool from_input; // Caused by input, input_ticks is valid
+    uint32_t input_ticks; // profiler_ticks() when that input was queued
+} RenderRequest;
+
+// Called on the render thread after a frame was published
+typedef void (*TeapotFrameCallback)(const RenderRequest* request, const RenderStats* stats, void* context);
+
+typedef struct TeapotRenderer TeapotRenderer;
+
+// Start a render thread drawing into frames. The thread owns the back
+// buffer of frames until teapot_renderer_free().
+TeapotRenderer* teapot_renderer_alloc(
+    TripleBuffer* frames,
+    uint32_t stack_size,
+    FuriThreadPriority priority,
+    TeapotFrameCallback callback,
+    void* context);
+
+// Stop and join the render thread
+void teapot_renderer_free(TeapotRenderer* renderer);
+
+// Replace any pending request with this one, never blocks. Requests equal
+// to the last rendered frame are dropped by the render thread.
+void teapot_renderer_post(TeapotRenderer* renderer, const RenderRequest* request);
+
+#endif // TEAPOT_RENDERER_H